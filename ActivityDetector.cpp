@@ -0,0 +1,307 @@
+#include "ActivityDetector.h"
+#include "HAL/FileManager.h"
+#include "Math/VectorRegister.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    constexpr uint32 ActivityIndexMagic = 0x49415452; // 'RTAI'
+    constexpr uint32 ActivityIndexVersion = 1;
+
+    FActivityRegion MakeRegion(int64 StartFrame, int64 EndFrame)
+    {
+        FActivityRegion Region;
+        Region.StartFrame = StartFrame;
+        Region.EndFrame = EndFrame;
+        return Region;
+    }
+
+    /** Sum of squares of 16-bit samples normalized to [-1, 1) */
+    float SumSquaresPCM16(const int16* Samples, int32 NumSamples)
+    {
+        constexpr int32 ChunkSize = 256;
+        alignas(16) float Scratch[ChunkSize];
+
+        VectorRegister4Float Accumulator = VectorZeroFloat();
+        float TailSum = 0.0f;
+
+        while (NumSamples > 0)
+        {
+            const int32 Count = FMath::Min(NumSamples, ChunkSize);
+
+            for (int32 Index = 0; Index < Count; Index++)
+            {
+                Scratch[Index] = Samples[Index] * (1.0f / 32768.0f);
+            }
+
+            const int32 NumVectorized = Count & ~3;
+            for (int32 Index = 0; Index < NumVectorized; Index += 4)
+            {
+                const VectorRegister4Float Value = VectorLoadAligned(&Scratch[Index]);
+                Accumulator = VectorMultiplyAdd(Value, Value, Accumulator);
+            }
+
+            for (int32 Index = NumVectorized; Index < Count; Index++)
+            {
+                TailSum += Scratch[Index] * Scratch[Index];
+            }
+
+            Samples += Count;
+            NumSamples -= Count;
+        }
+
+        alignas(16) float Lanes[4];
+        VectorStoreAligned(Accumulator, Lanes);
+        return Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3] + TailSum;
+    }
+
+    void SerializeSettings(FArchive& Ar, FActivityDetectionSettings& Settings)
+    {
+        Ar << Settings.OnThresholdDb;
+        Ar << Settings.OffThresholdDb;
+        Ar << Settings.AnalysisWindowSeconds;
+        Ar << Settings.MinActiveSeconds;
+        Ar << Settings.MinSilenceSeconds;
+        Ar << Settings.PaddingSeconds;
+    }
+}
+
+bool FActivityDetectionSettings::operator==(const FActivityDetectionSettings& Other) const
+{
+    return OnThresholdDb == Other.OnThresholdDb
+        && OffThresholdDb == Other.OffThresholdDb
+        && AnalysisWindowSeconds == Other.AnalysisWindowSeconds
+        && MinActiveSeconds == Other.MinActiveSeconds
+        && MinSilenceSeconds == Other.MinSilenceSeconds
+        && PaddingSeconds == Other.PaddingSeconds;
+}
+
+int64 FActivityIndex::GetActiveFrames() const
+{
+    int64 ActiveFrames = 0;
+    for (const FActivityRegion& Region : Regions)
+    {
+        ActiveFrames += Region.EndFrame - Region.StartFrame;
+    }
+    return ActiveFrames;
+}
+
+// =============================================================================
+// Streaming detection
+// =============================================================================
+FActivityDetector::FActivityDetector(const FActivityDetectionSettings& InSettings, int32 InSampleRate, int32 InNumChannels)
+    : Settings(InSettings)
+    , SampleRate(InSampleRate)
+    , NumChannels(FMath::Max(InNumChannels, 1))
+    , FramesPerWindow(FMath::Max(FMath::RoundToInt(InSettings.AnalysisWindowSeconds * InSampleRate), 1))
+    , WindowEnergy(0.0)
+    , WindowSamples(0)
+    , WindowStartFrame(0)
+    , FramesProcessed(0)
+    , bActive(false)
+    , ActiveStartFrame(0)
+{
+}
+
+void FActivityDetector::ProcessPCM16(const int16* Samples, int32 NumFrames)
+{
+    const int32 SamplesPerWindow = FramesPerWindow * NumChannels;
+    int32 Remaining = NumFrames * NumChannels;
+
+    while (Remaining > 0)
+    {
+        const int32 Count = FMath::Min(Remaining, SamplesPerWindow - WindowSamples);
+
+        WindowEnergy += SumSquaresPCM16(Samples, Count);
+        WindowSamples += Count;
+        Samples += Count;
+        Remaining -= Count;
+
+        if (WindowSamples == SamplesPerWindow)
+        {
+            ProcessWindow((float)(WindowEnergy / SamplesPerWindow), WindowStartFrame);
+            WindowStartFrame += FramesPerWindow;
+            WindowEnergy = 0.0;
+            WindowSamples = 0;
+        }
+    }
+
+    FramesProcessed += NumFrames;
+}
+
+void FActivityDetector::ProcessWindow(float MeanSquare, int64 StartFrame)
+{
+    const float LevelDb = 10.0f * FMath::LogX(10.0f, FMath::Max(MeanSquare, 1e-12f));
+
+    if (!bActive && LevelDb >= Settings.OnThresholdDb)
+    {
+        bActive = true;
+        ActiveStartFrame = StartFrame;
+    }
+    else if (bActive && LevelDb < Settings.OffThresholdDb)
+    {
+        bActive = false;
+        RawRegions.Add(MakeRegion(ActiveStartFrame, StartFrame));
+    }
+}
+
+FActivityIndex FActivityDetector::Finish()
+{
+    if (WindowSamples > 0)
+    {
+        ProcessWindow((float)(WindowEnergy / WindowSamples), WindowStartFrame);
+        WindowEnergy = 0.0;
+        WindowSamples = 0;
+    }
+
+    if (bActive)
+    {
+        bActive = false;
+        RawRegions.Add(MakeRegion(ActiveStartFrame, FramesProcessed));
+    }
+
+    const int64 MinSilenceFrames = (int64)(Settings.MinSilenceSeconds * SampleRate);
+    const int64 MinActiveFrames = (int64)(Settings.MinActiveSeconds * SampleRate);
+    const int64 PaddingFrames = (int64)(Settings.PaddingSeconds * SampleRate);
+
+    // Bridge short gaps first so a call broken up by brief dips survives the length filter
+    TArray<FActivityRegion> Merged;
+    for (const FActivityRegion& Region : RawRegions)
+    {
+        if (Merged.Num() > 0 && Region.StartFrame - Merged.Last().EndFrame < MinSilenceFrames)
+        {
+            Merged.Last().EndFrame = Region.EndFrame;
+        }
+        else
+        {
+            Merged.Add(Region);
+        }
+    }
+
+    FActivityIndex Index;
+    Index.SampleRate = SampleRate;
+    Index.TotalFrames = FramesProcessed;
+
+    for (const FActivityRegion& Region : Merged)
+    {
+        if (Region.EndFrame - Region.StartFrame < MinActiveFrames)
+        {
+            continue;
+        }
+
+        const FActivityRegion Padded = MakeRegion(FMath::Max<int64>(Region.StartFrame - PaddingFrames, 0),
+                                                  FMath::Min<int64>(Region.EndFrame + PaddingFrames, FramesProcessed));
+
+        if (Index.Regions.Num() > 0 && Padded.StartFrame <= Index.Regions.Last().EndFrame)
+        {
+            Index.Regions.Last().EndFrame = Padded.EndFrame;
+        }
+        else
+        {
+            Index.Regions.Add(Padded);
+        }
+    }
+
+    RawRegions.Empty();
+    return Index;
+}
+
+// =============================================================================
+// Persistence
+// =============================================================================
+FString FActivityDetector::GetIndexPath(const FString& WavFilePath)
+{
+    return WavFilePath + TEXT(".activity");
+}
+
+bool FActivityDetector::SaveIndex(const FString& WavFilePath, const FActivityDetectionSettings& Settings, const FActivityIndex& Index)
+{
+    IFileManager& FileManager = IFileManager::Get();
+
+    uint32 Magic = ActivityIndexMagic;
+    uint32 Version = ActivityIndexVersion;
+    int64 SourceFileSize = FileManager.FileSize(*WavFilePath);
+    int64 SourceTimeStamp = FileManager.GetTimeStamp(*WavFilePath).GetTicks();
+    FActivityDetectionSettings SettingsCopy = Settings;
+    int32 SampleRate = Index.SampleRate;
+    int64 TotalFrames = Index.TotalFrames;
+    int32 NumRegions = Index.Regions.Num();
+
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+    Writer << Magic << Version << SourceFileSize << SourceTimeStamp;
+    SerializeSettings(Writer, SettingsCopy);
+    Writer << SampleRate << TotalFrames << NumRegions;
+
+    for (const FActivityRegion& Region : Index.Regions)
+    {
+        int64 StartFrame = Region.StartFrame;
+        int64 EndFrame = Region.EndFrame;
+        Writer << StartFrame << EndFrame;
+    }
+
+    const FString IndexPath = GetIndexPath(WavFilePath);
+    if (!FFileHelper::SaveArrayToFile(Bytes, *IndexPath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to save activity index: %s"), *IndexPath);
+        return false;
+    }
+
+    return true;
+}
+
+bool FActivityDetector::LoadIndex(const FString& WavFilePath, const FActivityDetectionSettings& Settings, FActivityIndex& OutIndex)
+{
+    const FString IndexPath = GetIndexPath(WavFilePath);
+
+    TArray<uint8> Bytes;
+    if (!FPaths::FileExists(IndexPath) || !FFileHelper::LoadFileToArray(Bytes, *IndexPath))
+    {
+        return false;
+    }
+
+    IFileManager& FileManager = IFileManager::Get();
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    int64 SourceFileSize = 0;
+    int64 SourceTimeStamp = 0;
+    FActivityDetectionSettings StoredSettings;
+    int32 NumRegions = 0;
+
+    FMemoryReader Reader(Bytes);
+    Reader << Magic << Version << SourceFileSize << SourceTimeStamp;
+    SerializeSettings(Reader, StoredSettings);
+    Reader << OutIndex.SampleRate << OutIndex.TotalFrames << NumRegions;
+
+    if (Reader.IsError() || Magic != ActivityIndexMagic || Version != ActivityIndexVersion)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Ignoring unreadable activity index: %s"), *IndexPath);
+        return false;
+    }
+
+    // Stale if the WAV was replaced or the index was built with other parameters
+    if (SourceFileSize != FileManager.FileSize(*WavFilePath) ||
+        SourceTimeStamp != FileManager.GetTimeStamp(*WavFilePath).GetTicks() ||
+        !(StoredSettings == Settings))
+    {
+        return false;
+    }
+
+    if (NumRegions < 0 || (int64)NumRegions * 2 * sizeof(int64) > Reader.TotalSize() - Reader.Tell())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Ignoring corrupt activity index: %s"), *IndexPath);
+        return false;
+    }
+
+    OutIndex.Regions.SetNum(NumRegions);
+    for (FActivityRegion& Region : OutIndex.Regions)
+    {
+        Reader << Region.StartFrame << Region.EndFrame;
+    }
+
+    return !Reader.IsError();
+}
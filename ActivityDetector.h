@@ -0,0 +1,123 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActivityDetector.generated.h"
+
+/**
+ * Parameters for energy-based activity detection.
+ * A region opens when the short-term level rises above OnThresholdDb and closes when it
+ * falls below OffThresholdDb; the gap between the two is the hysteresis.
+ */
+USTRUCT(BlueprintType)
+struct TEST_API FActivityDetectionSettings
+{
+    GENERATED_BODY()
+
+    /** Level (dBFS RMS) that starts an active region */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Activity")
+    float OnThresholdDb = -40.0f;
+
+    /** Level (dBFS RMS) that ends an active region. Should be at or below OnThresholdDb. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Activity")
+    float OffThresholdDb = -46.0f;
+
+    /** Length of each energy measurement */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Activity")
+    float AnalysisWindowSeconds = 0.02f;
+
+    /** Active regions shorter than this are discarded */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Activity")
+    float MinActiveSeconds = 0.1f;
+
+    /** Silent gaps shorter than this are merged into the surrounding regions */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Activity")
+    float MinSilenceSeconds = 0.5f;
+
+    /** Extra audio kept before and after each region so onsets and tails are not clipped */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Activity")
+    float PaddingSeconds = 0.25f;
+
+    bool operator==(const FActivityDetectionSettings& Other) const;
+};
+
+/** A span of active audio, in frames */
+USTRUCT(BlueprintType)
+struct TEST_API FActivityRegion
+{
+    GENERATED_BODY()
+
+    /** First active frame */
+    UPROPERTY(BlueprintReadOnly, Category = "Audio|Activity")
+    int64 StartFrame = 0;
+
+    /** One past the last active frame */
+    UPROPERTY(BlueprintReadOnly, Category = "Audio|Activity")
+    int64 EndFrame = 0;
+};
+
+/** Sparse index of the active regions of one audio file */
+USTRUCT(BlueprintType)
+struct TEST_API FActivityIndex
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Audio|Activity")
+    int32 SampleRate = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Audio|Activity")
+    int64 TotalFrames = 0;
+
+    /** Sorted, non-overlapping */
+    UPROPERTY(BlueprintReadOnly, Category = "Audio|Activity")
+    TArray<FActivityRegion> Regions;
+
+    int64 GetActiveFrames() const;
+};
+
+/**
+ * Streaming activity detector for interleaved 16-bit PCM.
+ * Feed audio in blocks of any size with ProcessPCM16(), then call Finish() for the index.
+ * Energy is accumulated with SIMD over fixed analysis windows.
+ */
+class TEST_API FActivityDetector
+{
+public:
+    FActivityDetector(const FActivityDetectionSettings& InSettings, int32 InSampleRate, int32 InNumChannels);
+
+    /** Analyse the next block of interleaved frames */
+    void ProcessPCM16(const int16* Samples, int32 NumFrames);
+
+    /** Flush the last partial window and build the final region list */
+    FActivityIndex Finish();
+
+    /** Sidecar file the index for a WAV is persisted to ("<WavFilePath>.activity") */
+    static FString GetIndexPath(const FString& WavFilePath);
+
+    /** Persist an index next to its WAV, stamped with the WAV's size, timestamp and the settings used */
+    static bool SaveIndex(const FString& WavFilePath, const FActivityDetectionSettings& Settings, const FActivityIndex& Index);
+
+    /** Load a persisted index; fails if it is missing, or stale for this WAV or these settings */
+    static bool LoadIndex(const FString& WavFilePath, const FActivityDetectionSettings& Settings, FActivityIndex& OutIndex);
+
+private:
+    void ProcessWindow(float MeanSquare, int64 StartFrame);
+
+    FActivityDetectionSettings Settings;
+    int32 SampleRate;
+    int32 NumChannels;
+    int32 FramesPerWindow;
+
+    /** Partially filled analysis window */
+    double WindowEnergy;
+    int32 WindowSamples;
+    int64 WindowStartFrame;
+
+    /** Total frames seen so far */
+    int64 FramesProcessed;
+
+    bool bActive;
+    int64 ActiveStartFrame;
+
+    /** Regions from the hysteresis pass, before merging, filtering and padding */
+    TArray<FActivityRegion> RawRegions;
+};
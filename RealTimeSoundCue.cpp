@@ -2,6 +2,8 @@
 #include "RealTimeSoundCue.h"
 #include "Sound/SoundWave.h"
 #include "AudioDevice.h"
+#include "AudioDeviceManager.h"
+#include "Engine/Engine.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFilemanager.h"
@@ -36,12 +38,22 @@ bool URunTimeSoundCue::LoadAudioFileSync(const FString& FilePath)
     // Clear any previously loaded audio
     ClearLoadedAudio();
 
-    // Create sound wave from file
-    RuntimeSoundWave = CreateSoundWaveFromFile(FilePath);
-
+    // Reuse the sound wave from previous loads; only the first load creates one
     if (!RuntimeSoundWave)
     {
-        UE_LOG(LogAudio, Error, TEXT("RuntimeSoundCue: Failed to create SoundWave from file: %s"), *FilePath);
+        RuntimeSoundWave = NewObject<USoundWave>(this);
+        if (!RuntimeSoundWave)
+        {
+            UE_LOG(LogAudio, Error, TEXT("Failed to create SoundWave object"));
+            return false;
+        }
+    }
+
+    // Load sound wave from file
+    if (!LoadFileIntoSoundWave(RuntimeSoundWave, FilePath))
+    {
+        UE_LOG(LogAudio, Error, TEXT("RuntimeSoundCue: Failed to load SoundWave from file: %s"), *FilePath);
+        ResetSoundWave(RuntimeSoundWave);
         return false;
     }
 
@@ -60,10 +72,10 @@ bool URunTimeSoundCue::LoadAudioFileSync(const FString& FilePath)
 
 void URunTimeSoundCue::ClearLoadedAudio()
 {
+    // Keep the sound wave object for the next load; only its audio data is released
     if (RuntimeSoundWave)
     {
-        RuntimeSoundWave->RemoveFromRoot(); // Check if RemoveFromRoot frees memory
-        RuntimeSoundWave = nullptr;
+        ResetSoundWave(RuntimeSoundWave);
     }
 
     LoadedFilePath.Empty();
@@ -71,26 +83,42 @@ void URunTimeSoundCue::ClearLoadedAudio()
     FirstNode = nullptr;
 }
 
-USoundWave* URunTimeSoundCue::CreateSoundWaveFromFile(const FString& FilePath)
+void URunTimeSoundCue::ResetSoundWave(USoundWave* SoundWave)
+{
+    // Nothing may still be playing from the buffers we are about to free
+    if (FAudioDeviceManager* DeviceManager = GEngine ? GEngine->GetAudioDeviceManager() : nullptr)
+    {
+        DeviceManager->StopSoundsUsingResource(SoundWave);
+    }
+
+    // Drop decoded and cached platform data so the next load is decoded afresh
+    SoundWave->InvalidateCompressedData();
+    SoundWave->FreeResources();
+
+    if (SoundWave->RawPCMData)
+    {
+        FMemory::Free(SoundWave->RawPCMData);
+        SoundWave->RawPCMData = nullptr;
+    }
+
+    SoundWave->RawPCMDataSize = 0;
+    SoundWave->Duration = 0.0f;
+    SoundWave->RawData.UpdatePayload(FSharedBuffer());
+}
+
+bool URunTimeSoundCue::LoadFileIntoSoundWave(USoundWave* SoundWave, const FString& FilePath)
 {
     // Load the file data
     TArray<uint8> RawFileData;
     if (!FFileHelper::LoadFileToArray(RawFileData, *FilePath))
     {
         UE_LOG(LogAudio, Error, TEXT("Failed to load file data from: %s"), *FilePath);
-        return nullptr;
+        return false;
     }
 
     // Check file extension
     FString Extension = FPaths::GetExtension(FilePath).ToLower();
 
-    USoundWave* SoundWave = NewObject<USoundWave>(this);
-    if (!SoundWave)
-    {
-        UE_LOG(LogAudio, Error, TEXT("Failed to create SoundWave object"));
-        return nullptr;
-    }
-
     // Handle WAV files
     if (Extension == TEXT("wav"))
     {
@@ -101,7 +129,7 @@ USoundWave* URunTimeSoundCue::CreateSoundWaveFromFile(const FString& FilePath)
         if (!ParseWavFile(RawFileData, PCMData, SampleRate, NumChannels))
         {
             UE_LOG(LogAudio, Error, TEXT("Failed to parse WAV file: %s"), *FilePath);
-            return nullptr;
+            return false;
         }
 
         // Set up the sound wave
@@ -123,13 +151,11 @@ USoundWave* URunTimeSoundCue::CreateSoundWaveFromFile(const FString& FilePath)
     else
     {
         UE_LOG(LogAudio, Error, TEXT("Unsupported audio format: %s"), *Extension);
-        return nullptr;
+        return false;
     }
 
-    // Prevent garbage collection
-    SoundWave->AddToRoot();
-
-    return SoundWave;
+    // No AddToRoot: the RuntimeSoundWave UPROPERTY keeps the wave alive
+    return true;
 }
 
 bool URunTimeSoundCue::ParseWavFile(const TArray<uint8>& RawFileData, TArray<uint8>& OutPCMData, int32& OutSampleRate, int32& OutNumChannels) // Might be better to have library do it for us
@@ -60,15 +60,21 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Audio|Runtime")
     bool bIsLoaded;
 
-    /** The runtime-created sound wave */
+    /** The runtime-created sound wave, kept and refilled across loads */
     UPROPERTY()
     class USoundWave* RuntimeSoundWave;
 
 private:
     /**
-     * Create a SoundWave from raw audio data
+     * Fill an existing SoundWave from an audio file on disk
      */
-    USoundWave* CreateSoundWaveFromFile(const FString& FilePath);
+    bool LoadFileIntoSoundWave(USoundWave* SoundWave, const FString& FilePath);
+
+    /**
+     * Stop any sounds playing the SoundWave, then free its audio data and cached
+     * decode state so it can be refilled
+     */
+    void ResetSoundWave(USoundWave* SoundWave);
 
     /**
      * Parse WAV file format
@@ -1,9 +1,22 @@
 #include "RuntimeAudioPlayer.h"
+#include "SpectrogramEngine.h"
+#include "WavStreamReader.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFileManager.h"
 
+namespace
+{
+    /** Frames read per block when streaming a WAV for activity detection or region loading */
+    constexpr int64 StreamBlockFrames = 1 << 18;
+}
+
 ARuntimeAudioPlayer::ARuntimeAudioPlayer()
+    : bDetectActivityOnLoad(false)
+    , bSkipSilence(false)
+    , SoundWavePoolSize(8)
+    , AudioComponentPoolSize(4)
+    , ProceduralSoundWave(nullptr)
 {
     PrimaryActorTick.bCanEverTick = false;
 
@@ -21,6 +34,17 @@ void ARuntimeAudioPlayer::BeginPlay()
 
     UE_LOG(LogTemp, Warning, TEXT("RuntimeAudioPlayer::BeginPlay fired"));
 
+    // Pre-warm the pools so auditioning never allocates UObjects once play has started
+    while (FreeSoundWaves.Num() < SoundWavePoolSize)
+    {
+        FreeSoundWaves.Add(NewObject<USoundWaveProcedural>(this));
+    }
+
+    while (FreeAudioComponents.Num() < AudioComponentPoolSize)
+    {
+        FreeAudioComponents.Add(CreatePooledAudioComponent());
+    }
+
     // Single-file test playback (if AudioFilePath is set in Details panel)
     if (!AudioFilePath.IsEmpty())
     {
@@ -39,11 +63,41 @@ void ARuntimeAudioPlayer::BeginPlay()
 // Single file: Load (without playing)
 // =============================================================================
 USoundWaveProcedural* ARuntimeAudioPlayer::LoadWavFromFile(const FString& FilePath)
+{
+    TArray<uint8> FinalPCM;
+    int32 SampleRate = 0;
+    int32 NumChannels = 0;
+
+    if (!LoadWavAs16Bit(FilePath, FinalPCM, SampleRate, NumChannels))
+    {
+        return nullptr;
+    }
+
+    // Only detect when neither this session nor a sidecar already has an index
+    FActivityIndex ExistingIndex;
+    if (bDetectActivityOnLoad && !FindActivityIndex(FilePath, ExistingIndex))
+    {
+        DetectActivity(FilePath, FinalPCM, SampleRate, NumChannels);
+    }
+
+    USoundWaveProcedural* SoundWave = CreateProceduralSoundWave(FinalPCM.GetData(), FinalPCM.Num(), SampleRate, NumChannels);
+    if (!SoundWave)
+    {
+        return nullptr;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Loaded: %s (%.2fs)"), *FPaths::GetCleanFilename(FilePath), SoundWave->Duration);
+
+    return SoundWave;
+}
+
+bool ARuntimeAudioPlayer::LoadWavAs16Bit(const FString& FilePath, TArray<uint8>& OutPCM16,
+                                         int32& OutSampleRate, int32& OutNumChannels)
 {
     if (!FPaths::FileExists(FilePath))
     {
         UE_LOG(LogTemp, Error, TEXT("File not found: %s"), *FilePath);
-        return nullptr;
+        return false;
     }
 
     UE_LOG(LogTemp, Log, TEXT("Loading WAV file: %s"), *FilePath);
@@ -53,34 +107,42 @@ USoundWaveProcedural* ARuntimeAudioPlayer::LoadWavFromFile(const FString& FilePa
     if (!FFileHelper::LoadFileToArray(RawData, *FilePath))
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to load file: %s"), *FilePath);
-        return nullptr;
+        return false;
     }
 
     // Parse WAV header and extract PCM data
     TArray<uint8> PCMData;
-    int32 SampleRate = 0;
-    int32 NumChannels = 0;
     int32 BitsPerSample = 0;
 
-    if (!ParseWavFile(RawData, PCMData, SampleRate, NumChannels, BitsPerSample))
+    if (!ParseWavFile(RawData, PCMData, OutSampleRate, OutNumChannels, BitsPerSample))
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to parse WAV: %s"), *FilePath);
-        return nullptr;
+        return false;
     }
 
     UE_LOG(LogTemp, Log, TEXT("WAV parsed: %d Hz, %d ch, %d-bit, %d bytes PCM"),
-           SampleRate, NumChannels, BitsPerSample, PCMData.Num());
+           OutSampleRate, OutNumChannels, BitsPerSample, PCMData.Num());
 
     // Convert to 16-bit if needed
-    TArray<uint8> FinalPCM;
-    if (!ConvertTo16Bit(PCMData, BitsPerSample, FinalPCM))
+    if (!ConvertTo16Bit(PCMData, BitsPerSample, OutPCM16))
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to convert audio to 16-bit PCM"));
-        return nullptr;
+        return false;
     }
 
-    // Create USoundWaveProcedural
-    USoundWaveProcedural* SoundWave = NewObject<USoundWaveProcedural>(this);
+    if (BitsPerSample != 16)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Converted %d-bit -> 16-bit PCM: %d -> %d bytes"),
+               BitsPerSample, PCMData.Num(), OutPCM16.Num());
+    }
+
+    return true;
+}
+
+USoundWaveProcedural* ARuntimeAudioPlayer::CreateProceduralSoundWave(const uint8* PCMData, int32 NumBytes,
+                                                                     int32 SampleRate, int32 NumChannels)
+{
+    USoundWaveProcedural* SoundWave = AcquireSoundWave();
     if (!SoundWave)
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to create USoundWaveProcedural"));
@@ -89,14 +151,12 @@ USoundWaveProcedural* ARuntimeAudioPlayer::LoadWavFromFile(const FString& FilePa
 
     SoundWave->SetSampleRate(SampleRate);
     SoundWave->NumChannels = NumChannels;
-    SoundWave->Duration = (float)FinalPCM.Num() / (SampleRate * NumChannels * sizeof(int16));
+    SoundWave->Duration = (float)NumBytes / (SampleRate * NumChannels * sizeof(int16));
     SoundWave->SoundGroup = SOUNDGROUP_Default;
     SoundWave->bLooping = false;
 
     // Queue the entire PCM buffer
-    SoundWave->QueueAudio(FinalPCM.GetData(), FinalPCM.Num());
-
-    UE_LOG(LogTemp, Log, TEXT("Loaded: %s (%.2fs)"), *FPaths::GetCleanFilename(FilePath), SoundWave->Duration);
+    SoundWave->QueueAudio(PCMData, NumBytes);
 
     return SoundWave;
 }
@@ -106,25 +166,400 @@ USoundWaveProcedural* ARuntimeAudioPlayer::LoadWavFromFile(const FString& FilePa
 // =============================================================================
 bool ARuntimeAudioPlayer::PlayWavFromFile(const FString& FilePath)
 {
-    ProceduralSoundWave = LoadWavFromFile(FilePath);
-    if (!ProceduralSoundWave)
+    if (bSkipSilence)
+    {
+        return PlayActiveRegionsFromFile(FilePath);
+    }
+
+    USoundWaveProcedural* SoundWave = LoadWavFromFile(FilePath);
+    if (!SoundWave)
     {
         return false;
     }
 
-    AudioComponent->SetSound(ProceduralSoundWave);
-    AudioComponent->Play();
+    PlayOnAudioComponent(SoundWave);
 
     UE_LOG(LogTemp, Log, TEXT("AudioComponent->Play() called"));
     return true;
 }
 
+void ARuntimeAudioPlayer::PlayOnAudioComponent(USoundWaveProcedural* SoundWave)
+{
+    USoundWaveProcedural* PreviousSoundWave = ProceduralSoundWave;
+
+    AudioComponent->Stop();
+    AudioComponent->SetSound(SoundWave);
+    ProceduralSoundWave = SoundWave;
+
+    // The previous clip is no longer referenced by the component, so it can be reused
+    if (PreviousSoundWave && PreviousSoundWave != SoundWave)
+    {
+        ReleaseSoundWave(PreviousSoundWave);
+    }
+
+    AudioComponent->Play();
+}
+
+// =============================================================================
+// Single file: Activity detection
+// =============================================================================
+void ARuntimeAudioPlayer::DetectActivity(const FString& FilePath, const TArray<uint8>& PCM16, int32 SampleRate, int32 NumChannels)
+{
+    if (SampleRate <= 0 || NumChannels <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Activity: Invalid format (%d Hz, %d ch): %s"), SampleRate, NumChannels, *FilePath);
+        return;
+    }
+
+    const int32 NumFrames = PCM16.Num() / (NumChannels * (int32)sizeof(int16));
+
+    FActivityDetector Detector(ActivityDetection, SampleRate, NumChannels);
+    Detector.ProcessPCM16(reinterpret_cast<const int16*>(PCM16.GetData()), NumFrames);
+
+    StoreActivityIndex(FilePath, Detector.Finish());
+}
+
+bool ARuntimeAudioPlayer::DetectActivityFromFile(const FString& FilePath)
+{
+    FWavStreamReader Reader;
+    if (!Reader.Open(FilePath))
+    {
+        return false;
+    }
+
+    FActivityDetector Detector(ActivityDetection, Reader.GetSampleRate(), Reader.GetNumChannels());
+
+    // Only one block of the file is ever held in memory
+    TArray<uint8> BlockPCM;
+    TArray<uint8> Block16Bit;
+
+    for (int64 StartFrame = 0; StartFrame < Reader.GetNumFrames(); StartFrame += StreamBlockFrames)
+    {
+        if (!Reader.ReadFrames(StartFrame, StreamBlockFrames, BlockPCM) ||
+            !ConvertTo16Bit(BlockPCM, Reader.GetBitsPerSample(), Block16Bit))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Activity: Failed to read frames from %lld of %s"), StartFrame, *FilePath);
+            return false;
+        }
+
+        const int32 NumFrames = Block16Bit.Num() / (Reader.GetNumChannels() * (int32)sizeof(int16));
+        Detector.ProcessPCM16(reinterpret_cast<const int16*>(Block16Bit.GetData()), NumFrames);
+    }
+
+    StoreActivityIndex(FilePath, Detector.Finish());
+    return true;
+}
+
+void ARuntimeAudioPlayer::StoreActivityIndex(const FString& FilePath, FActivityIndex&& Index)
+{
+    UE_LOG(LogTemp, Log, TEXT("Activity: %s has %d regions, %.2fs active of %.2fs"),
+           *FPaths::GetCleanFilename(FilePath), Index.Regions.Num(),
+           (double)Index.GetActiveFrames() / Index.SampleRate, (double)Index.TotalFrames / Index.SampleRate);
+
+    FActivityDetector::SaveIndex(FilePath, ActivityDetection, Index);
+
+    DiscardStaleActivityIndices();
+    ActivityIndices.Add(FilePath, MoveTemp(Index));
+}
+
+void ARuntimeAudioPlayer::DiscardStaleActivityIndices()
+{
+    // ActivityDetection can be edited at any time, e.g. from Blueprint
+    if (!(ActivityIndicesSettings == ActivityDetection))
+    {
+        ActivityIndices.Empty();
+        ActivityIndicesSettings = ActivityDetection;
+    }
+}
+
+bool ARuntimeAudioPlayer::FindActivityIndex(const FString& FilePath, FActivityIndex& OutIndex)
+{
+    DiscardStaleActivityIndices();
+
+    if (const FActivityIndex* Existing = ActivityIndices.Find(FilePath))
+    {
+        OutIndex = *Existing;
+        return true;
+    }
+
+    if (FActivityDetector::LoadIndex(FilePath, ActivityDetection, OutIndex))
+    {
+        ActivityIndices.Add(FilePath, OutIndex);
+        return true;
+    }
+
+    return false;
+}
+
+bool ARuntimeAudioPlayer::GetActivityIndex(const FString& FilePath, FActivityIndex& OutIndex)
+{
+    if (FindActivityIndex(FilePath, OutIndex))
+    {
+        return true;
+    }
+
+    // No usable index yet — one streaming pass builds and persists it
+    if (!DetectActivityFromFile(FilePath))
+    {
+        return false;
+    }
+
+    OutIndex = ActivityIndices.FindChecked(FilePath);
+    return true;
+}
+
+USoundWaveProcedural* ARuntimeAudioPlayer::LoadActiveRegionsFromFile(const FString& FilePath)
+{
+    FActivityIndex Index;
+    if (!GetActivityIndex(FilePath, Index))
+    {
+        UE_LOG(LogTemp, Error, TEXT("No activity index for: %s"), *FilePath);
+        return nullptr;
+    }
+
+    if (Index.Regions.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No activity detected in: %s"), *FilePath);
+        return nullptr;
+    }
+
+    // Read only the active regions from disk
+    FWavStreamReader Reader;
+    if (!Reader.Open(FilePath))
+    {
+        return nullptr;
+    }
+
+    const int32 NumChannels = Reader.GetNumChannels();
+
+    // The joined regions must fit in a single sound wave buffer
+    const int64 ActiveBytes = Index.GetActiveFrames() * NumChannels * (int64)sizeof(int16);
+    if (ActiveBytes > MAX_int32)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Active regions of %s are too large to load (%lld bytes)"), *FilePath, ActiveBytes);
+        return nullptr;
+    }
+
+    TArray<uint8> ActivePCM;
+    ActivePCM.Reserve((int32)ActiveBytes);
+
+    TArray<uint8> BlockPCM;
+    TArray<uint8> Block16Bit;
+
+    for (const FActivityRegion& Region : Index.Regions)
+    {
+        for (int64 StartFrame = Region.StartFrame; StartFrame < Region.EndFrame; StartFrame += StreamBlockFrames)
+        {
+            const int64 NumFrames = FMath::Min(StreamBlockFrames, Region.EndFrame - StartFrame);
+            if (!Reader.ReadFrames(StartFrame, NumFrames, BlockPCM) ||
+                !ConvertTo16Bit(BlockPCM, Reader.GetBitsPerSample(), Block16Bit))
+            {
+                UE_LOG(LogTemp, Error, TEXT("Failed to read active region [%lld, %lld) of %s"),
+                       Region.StartFrame, Region.EndFrame, *FilePath);
+                return nullptr;
+            }
+
+            ActivePCM.Append(Block16Bit);
+        }
+    }
+
+    USoundWaveProcedural* SoundWave = CreateProceduralSoundWave(ActivePCM.GetData(), ActivePCM.Num(),
+                                                                Reader.GetSampleRate(), NumChannels);
+    if (!SoundWave)
+    {
+        return nullptr;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Loaded active regions: %s (%d regions, %.2fs of %.2fs)"),
+           *FPaths::GetCleanFilename(FilePath), Index.Regions.Num(), SoundWave->Duration,
+           (double)Index.TotalFrames / Index.SampleRate);
+
+    return SoundWave;
+}
+
+bool ARuntimeAudioPlayer::PlayActiveRegionsFromFile(const FString& FilePath)
+{
+    USoundWaveProcedural* SoundWave = LoadActiveRegionsFromFile(FilePath);
+    if (!SoundWave)
+    {
+        return false;
+    }
+
+    PlayOnAudioComponent(SoundWave);
+
+    UE_LOG(LogTemp, Log, TEXT("AudioComponent->Play() called (active regions only)"));
+    return true;
+}
+
+// =============================================================================
+// Single file: Spectrogram
+// =============================================================================
+USpectrogramEngine* ARuntimeAudioPlayer::OpenSpectrogram(const FString& FilePath)
+{
+    USpectrogramEngine* Spectrogram = NewObject<USpectrogramEngine>(this);
+    if (!Spectrogram->Open(FilePath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to open spectrogram: %s"), *FilePath);
+        return nullptr;
+    }
+
+    return Spectrogram;
+}
+
+// =============================================================================
+// Object pooling
+// =============================================================================
+USoundWaveProcedural* ARuntimeAudioPlayer::AcquireSoundWave()
+{
+    USoundWaveProcedural* SoundWave = nullptr;
+
+    // Oldest first: a wave released just now may still be read by a source that is stopping
+    if (FreeSoundWaves.Num() > 0)
+    {
+        SoundWave = FreeSoundWaves[0];
+        FreeSoundWaves.RemoveAt(0);
+    }
+    else
+    {
+        // Forget waves that callers dropped without releasing
+        for (auto It = InUseSoundWaves.CreateIterator(); It; ++It)
+        {
+            if (!It->IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        SoundWave = NewObject<USoundWaveProcedural>(this);
+    }
+
+    InUseSoundWaves.Add(SoundWave);
+    return SoundWave;
+}
+
+void ARuntimeAudioPlayer::ReleaseSoundWave(USoundWaveProcedural* SoundWave)
+{
+    // Ignore waves that are already free or were never handed out by this actor
+    if (!SoundWave || InUseSoundWaves.Remove(SoundWave) == 0)
+    {
+        return;
+    }
+
+    // A released wave is no longer the caller's, so it must not be released again through LoadedSounds
+    const int32 LoadedIndex = LoadedSounds.Find(SoundWave);
+    if (LoadedIndex != INDEX_NONE)
+    {
+        LoadedSounds.RemoveAt(LoadedIndex);
+        LoadedFilePaths.RemoveAt(LoadedIndex);
+    }
+
+    if (SoundWave == ProceduralSoundWave)
+    {
+        AudioComponent->Stop();
+        AudioComponent->SetSound(nullptr);
+        ProceduralSoundWave = nullptr;
+    }
+
+    // Stop the audition component still playing it; its finished callback is unbound first
+    if (UAudioComponent* Component = SoundWaveComponents.FindRef(SoundWave))
+    {
+        ReleaseAudioComponent(Component);
+    }
+
+    // Drop any audio still queued so the next user starts from silence
+    SoundWave->ResetAudio();
+
+    // Beyond the pool size the wave is simply left for the GC
+    if (FreeSoundWaves.Num() < SoundWavePoolSize)
+    {
+        FreeSoundWaves.Add(SoundWave);
+    }
+}
+
+UAudioComponent* ARuntimeAudioPlayer::AcquireAudioComponent()
+{
+    if (FreeAudioComponents.Num() > 0)
+    {
+        return FreeAudioComponents.Pop();
+    }
+
+    return CreatePooledAudioComponent();
+}
+
+UAudioComponent* ARuntimeAudioPlayer::CreatePooledAudioComponent()
+{
+    UAudioComponent* Component = NewObject<UAudioComponent>(this);
+    Component->bAutoActivate = false;
+    Component->SetupAttachment(RootComponent);
+    Component->RegisterComponent();
+    return Component;
+}
+
+void ARuntimeAudioPlayer::ReleaseAudioComponent(UAudioComponent* Component)
+{
+    if (!Component || FreeAudioComponents.Contains(Component))
+    {
+        return;
+    }
+
+    Component->OnAudioFinishedNative.RemoveAll(this);
+    Component->Stop();
+
+    USoundWaveProcedural* SoundWave = Cast<USoundWaveProcedural>(Component->Sound);
+    if (SoundWave && SoundWaveComponents.FindRef(SoundWave) == Component)
+    {
+        SoundWaveComponents.Remove(SoundWave);
+    }
+
+    Component->SetSound(nullptr);
+
+    if (FreeAudioComponents.Num() < AudioComponentPoolSize)
+    {
+        FreeAudioComponents.Add(Component);
+    }
+    else
+    {
+        Component->DestroyComponent();
+    }
+}
+
+void ARuntimeAudioPlayer::OnPooledAudioFinished(UAudioComponent* Component)
+{
+    // Only recycle the wave if it still belongs to this playback and not to a later user
+    USoundWaveProcedural* SoundWave = Cast<USoundWaveProcedural>(Component->Sound);
+    const bool bOwnsSoundWave = SoundWave && SoundWaveComponents.FindRef(SoundWave) == Component;
+
+    ReleaseAudioComponent(Component);
+
+    if (bOwnsSoundWave)
+    {
+        ReleaseSoundWave(SoundWave);
+    }
+}
+
+UAudioComponent* ARuntimeAudioPlayer::AuditionWavFromFile(const FString& FilePath)
+{
+    USoundWaveProcedural* SoundWave = LoadWavFromFile(FilePath);
+    if (!SoundWave)
+    {
+        return nullptr;
+    }
+
+    UAudioComponent* Component = AcquireAudioComponent();
+    Component->SetSound(SoundWave);
+    Component->OnAudioFinishedNative.AddUObject(this, &ARuntimeAudioPlayer::OnPooledAudioFinished);
+    SoundWaveComponents.Add(SoundWave, Component);
+    Component->Play();
+
+    return Component;
+}
+
 // =============================================================================
 // Batch folder loading
 // =============================================================================
 TArray<USoundWaveProcedural*> ARuntimeAudioPlayer::LoadWavsFromFolder(const FString& AudioFolderPath, bool bRecursive)
 {
-    // Clear previous results
+    // Clear previous results; the sounds themselves stay with whoever they were handed to
     LoadedSounds.Empty();
     LoadedFilePaths.Empty();
 
@@ -140,55 +575,170 @@ TArray<USoundWaveProcedural*> ARuntimeAudioPlayer::LoadWavsFromFolder(const FStr
 
     // Find all .wav files
     TArray<FString> FoundFiles;
+    FindWavFiles(AudioFolderPath, bRecursive, FoundFiles);
+
+    UE_LOG(LogTemp, Warning, TEXT("Found %d WAV files"), FoundFiles.Num());
+
+    // Load each file
+    int32 SuccessCount = 0;
+    int32 FailCount = 0;
+
+    for (const FString& WavPath : FoundFiles)
+    {
+        USoundWaveProcedural* Sound = LoadWavFromFile(WavPath);
+        if (Sound)
+        {
+            LoadedSounds.Add(Sound);
+            LoadedFilePaths.Add(WavPath);
+            SuccessCount++;
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Skipped (failed to load): %s"), *WavPath);
+            FailCount++;
+        }
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("Batch load complete: %d loaded, %d failed, %d total"),
+           SuccessCount, FailCount, FoundFiles.Num());
+
+    return LoadedSounds;
+}
+
+void ARuntimeAudioPlayer::ReleaseLoadedSounds()
+{
+    TArray<USoundWaveProcedural*> Sounds = MoveTemp(LoadedSounds);
+    LoadedSounds.Reset();
+    LoadedFilePaths.Reset();
+
+    for (USoundWaveProcedural* Sound : Sounds)
+    {
+        ReleaseSoundWave(Sound);
+    }
+}
+
+// =============================================================================
+// Folder scanning
+// =============================================================================
+void ARuntimeAudioPlayer::FindWavFiles(const FString& AudioFolderPath, bool bRecursive, TArray<FString>& OutFiles) const
+{
     IFileManager& FileManager = IFileManager::Get();
 
     if (bRecursive)
     {
         // Recursive: find WAVs in all subdirectories
-        FileManager.FindFilesRecursive(FoundFiles, *AudioFolderPath, TEXT("*.wav"), true, false);
+        FileManager.FindFilesRecursive(OutFiles, *AudioFolderPath, TEXT("*.wav"), true, false);
     }
     else
     {
         // Non-recursive: only this folder
         FString SearchPattern = FPaths::Combine(AudioFolderPath, TEXT("*.wav"));
-        FileManager.FindFiles(FoundFiles, *SearchPattern, true, false);
+        FileManager.FindFiles(OutFiles, *SearchPattern, true, false);
 
         // FindFiles returns filenames only — prepend the folder path
-        for (FString& FileName : FoundFiles)
+        for (FString& FileName : OutFiles)
         {
             FileName = FPaths::Combine(AudioFolderPath, FileName);
         }
     }
 
     // Sort for consistent ordering
-    FoundFiles.Sort();
+    OutFiles.Sort();
+}
 
-    UE_LOG(LogTemp, Warning, TEXT("Found %d WAV files"), FoundFiles.Num());
+// =============================================================================
+// Packed sound banks
+// =============================================================================
+bool ARuntimeAudioPlayer::PackWavsToBank(const FString& AudioFolderPath, const FString& BankFilePath, bool bRecursive)
+{
+    if (!FPaths::DirectoryExists(AudioFolderPath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Folder not found: %s"), *AudioFolderPath);
+        return false;
+    }
+
+    TArray<FString> FoundFiles;
+    FindWavFiles(AudioFolderPath, bRecursive, FoundFiles);
+
+    UE_LOG(LogTemp, Warning, TEXT("Packing %d WAV files from %s into %s"),
+           FoundFiles.Num(), *AudioFolderPath, *BankFilePath);
+
+    FSoundBankWriter Writer;
+    if (!Writer.Open(BankFilePath))
+    {
+        return false;
+    }
+
+    // Clip keys are relative to the packed folder
+    FString FolderPrefix = AudioFolderPath;
+    FPaths::NormalizeDirectoryName(FolderPrefix);
+    FolderPrefix += TEXT("/");
 
-    // Load each file
-    int32 SuccessCount = 0;
     int32 FailCount = 0;
 
     for (const FString& WavPath : FoundFiles)
     {
-        USoundWaveProcedural* Sound = LoadWavFromFile(WavPath);
-        if (Sound)
-        {
-            LoadedSounds.Add(Sound);
-            LoadedFilePaths.Add(WavPath);
-            SuccessCount++;
-        }
-        else
+        TArray<uint8> PCM16;
+        int32 SampleRate = 0;
+        int32 NumChannels = 0;
+
+        FString ClipPath = WavPath;
+        FPaths::MakePathRelativeTo(ClipPath, *FolderPrefix);
+
+        if (!LoadWavAs16Bit(WavPath, PCM16, SampleRate, NumChannels) ||
+            !Writer.AddClip(ClipPath, SampleRate, NumChannels, PCM16))
         {
-            UE_LOG(LogTemp, Warning, TEXT("Skipped (failed to load): %s"), *WavPath);
+            UE_LOG(LogTemp, Warning, TEXT("Skipped (failed to pack): %s"), *WavPath);
             FailCount++;
         }
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("Batch load complete: %d loaded, %d failed, %d total"),
-           SuccessCount, FailCount, FoundFiles.Num());
+    if (!Writer.Finalize())
+    {
+        return false;
+    }
 
-    return LoadedSounds;
+    UE_LOG(LogTemp, Warning, TEXT("Bank pack complete: %d packed, %d failed, %d total"),
+           Writer.GetNumClips(), FailCount, FoundFiles.Num());
+
+    return true;
+}
+
+bool ARuntimeAudioPlayer::LoadSoundBank(const FString& BankFilePath)
+{
+    if (!SoundBank.Open(BankFilePath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to load sound bank: %s"), *BankFilePath);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("Sound bank loaded: %s (%d clips)"), *BankFilePath, SoundBank.GetNumClips());
+    return true;
+}
+
+USoundWaveProcedural* ARuntimeAudioPlayer::LoadWavFromBank(const FString& ClipPath)
+{
+    if (!SoundBank.IsOpen())
+    {
+        UE_LOG(LogTemp, Error, TEXT("No sound bank loaded"));
+        return nullptr;
+    }
+
+    FSoundBankClipView Clip;
+    if (!SoundBank.FindClip(ClipPath, Clip))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Clip not found in sound bank: %s"), *ClipPath);
+        return nullptr;
+    }
+
+    return CreateProceduralSoundWave(Clip.PCMData.GetData(), Clip.PCMData.Num(), Clip.SampleRate, Clip.NumChannels);
+}
+
+TArray<FString> ARuntimeAudioPlayer::GetBankClipPaths() const
+{
+    TArray<FString> ClipPaths;
+    SoundBank.GetClipPaths(ClipPaths);
+    return ClipPaths;
 }
 
 // =============================================================================
@@ -212,8 +762,6 @@ bool ARuntimeAudioPlayer::ConvertTo16Bit(const TArray<uint8>& InPCMData, int32 B
             Out16BitPCM[i * 2 + 1] = InPCMData[i * 3 + 2];
         }
 
-        UE_LOG(LogTemp, Log, TEXT("Converted 24-bit -> 16-bit PCM: %d -> %d bytes"),
-               InPCMData.Num(), Out16BitPCM.Num());
         return true;
     }
     else if (BitsPerSample == 32)
@@ -227,8 +775,6 @@ bool ARuntimeAudioPlayer::ConvertTo16Bit(const TArray<uint8>& InPCMData, int32 B
             Out16BitPCM[i * 2 + 1] = InPCMData[i * 4 + 3];
         }
 
-        UE_LOG(LogTemp, Log, TEXT("Converted 32-bit -> 16-bit PCM: %d -> %d bytes"),
-               InPCMData.Num(), Out16BitPCM.Num());
         return true;
     }
 
@@ -297,6 +843,12 @@ bool ARuntimeAudioPlayer::ParseWavFile(const TArray<uint8>& RawFileData, TArray<
         return false;
     }
 
+    if (OutNumChannels <= 0 || OutSampleRate <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid WAV format: %d channels, %d Hz"), OutNumChannels, OutSampleRate);
+        return false;
+    }
+
     UE_LOG(LogTemp, Log, TEXT("fmt chunk: format=%d, channels=%d, sampleRate=%d, bitsPerSample=%d"),
            AudioFormat, OutNumChannels, OutSampleRate, OutBitsPerSample);
 
@@ -324,7 +876,7 @@ bool ARuntimeAudioPlayer::ParseWavFile(const TArray<uint8>& RawFileData, TArray<
         return false;
     }
 
-    if (DataOffset + (int32)DataSize > RawFileData.Num())
+    if ((int64)DataOffset + DataSize > RawFileData.Num())
     {
         UE_LOG(LogTemp, Warning, TEXT("data chunk size (%u) exceeds file bounds, clamping"), DataSize);
         DataSize = RawFileData.Num() - DataOffset;
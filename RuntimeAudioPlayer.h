@@ -4,8 +4,12 @@
 #include "GameFramework/Actor.h"
 #include "Sound/SoundWaveProcedural.h"
 #include "Components/AudioComponent.h"
+#include "SoundBank.h"
+#include "ActivityDetector.h"
 #include "RuntimeAudioPlayer.generated.h"
 
+class USpectrogramEngine;
+
 /**
  * A runtime audio player that loads WAV files from disk and plays them
  * using USoundWaveProcedural (no precaching, no asset import needed).
@@ -51,6 +55,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Audio|Runtime")
     bool PlayWavFromFile(const FString& FilePath);
 
+    /**
+     * Open a WAV file for spectrogram viewing. Tiles are computed on demand while
+     * streaming the file and cached next to it (see USpectrogramEngine).
+     *
+     * @param FilePath  Absolute path to a WAV file on disk
+     * @return          Spectrogram engine owned by this actor, or nullptr on failure
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Runtime")
+    USpectrogramEngine* OpenSpectrogram(const FString& FilePath);
+
     // -----------------------------------------------------------------
     // Batch folder loading
     // -----------------------------------------------------------------
@@ -67,11 +81,126 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Audio|Runtime")
     TArray<USoundWaveProcedural*> LoadWavsFromFolder(const FString& AudioFolderPath, bool bRecursive = true);
 
+    // -----------------------------------------------------------------
+    // Packed sound banks
+    // -----------------------------------------------------------------
+
+    /**
+     * Offline packer: load every WAV under a folder, convert it to 16-bit PCM and
+     * write it into a single bank file with a sorted index.
+     * Clips are keyed by their path relative to AudioFolderPath (e.g. "siteA/mic_02/audio.wav").
+     *
+     * @param AudioFolderPath   Absolute path to the folder to pack
+     * @param BankFilePath      Output bank file (overwritten)
+     * @param bRecursive        If true, also packs all subdirectories
+     * @return                  True if the bank was written (files that fail to load are skipped)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Runtime")
+    bool PackWavsToBank(const FString& AudioFolderPath, const FString& BankFilePath, bool bRecursive = true);
+
+    /**
+     * Memory-map a bank written by PackWavsToBank(). Replaces any previously loaded bank.
+     * No clip data is read until a clip is requested.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Runtime")
+    bool LoadSoundBank(const FString& BankFilePath);
+
+    /**
+     * Create a USoundWaveProcedural for one clip of the loaded bank.
+     * The PCM is queued straight from the mapped bank — no file open, parse or conversion.
+     *
+     * @param ClipPath  Bank-relative clip path, as returned by GetBankClipPaths()
+     * @return          Loaded sound, or nullptr if no bank is loaded or the clip is missing
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Runtime")
+    USoundWaveProcedural* LoadWavFromBank(const FString& ClipPath);
+
+    /** All clip paths in the loaded bank, sorted */
+    UFUNCTION(BlueprintPure, Category = "Audio|Runtime")
+    TArray<FString> GetBankClipPaths() const;
+
+    /** The loaded bank, for C++ callers that want zero-copy access to clip PCM */
+    const FRuntimeSoundBank& GetSoundBank() const { return SoundBank; }
+
+    // -----------------------------------------------------------------
+    // Activity detection (skip silence)
+    // -----------------------------------------------------------------
+
+    /** If true, LoadWavFromFile() also builds an activity index and saves it next to the WAV */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Activity")
+    bool bDetectActivityOnLoad;
+
+    /** If true, PlayWavFromFile() plays only the active regions, back-to-back */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Activity")
+    bool bSkipSilence;
+
+    /** Thresholds, hysteresis and minimum durations used for activity detection */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Activity")
+    FActivityDetectionSettings ActivityDetection;
+
+    /** Activity indices built or loaded this session, keyed by file path. Cleared when ActivityDetection changes. */
+    UPROPERTY(BlueprintReadOnly, Category = "Audio|Activity")
+    TMap<FString, FActivityIndex> ActivityIndices;
+
+    /**
+     * Get the activity index for a WAV file.
+     * Uses, in order: this session's index, the ".activity" file saved next to the WAV,
+     * or a detection pass that streams the file in blocks (which then saves the ".activity" file).
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Activity")
+    bool GetActivityIndex(const FString& FilePath, FActivityIndex& OutIndex);
+
+    /**
+     * Load only the active regions of a WAV file, joined back-to-back.
+     * Once an index exists, silent stretches are never read from disk.
+     *
+     * @param FilePath  Absolute path to a WAV file on disk
+     * @return          Loaded sound, or nullptr on failure or if the file has no activity
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Activity")
+    USoundWaveProcedural* LoadActiveRegionsFromFile(const FString& FilePath);
+
+    /** Load the active regions of a WAV file and play them immediately on this actor's AudioComponent */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Activity")
+    bool PlayActiveRegionsFromFile(const FString& FilePath);
+
+    // -----------------------------------------------------------------
+    // Object pooling
+    // -----------------------------------------------------------------
+
+    /** Maximum number of idle procedural sound waves kept for reuse */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Pool", meta = (ClampMin = "0"))
+    int32 SoundWavePoolSize;
+
+    /** Maximum number of idle audio components kept for reuse by AuditionWavFromFile() */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Pool", meta = (ClampMin = "0"))
+    int32 AudioComponentPoolSize;
+
+    /**
+     * Load a WAV file and play it on a pooled audio component, so several clips can overlap.
+     * The component and the sound wave are reset and returned to their pools when playback
+     * finishes or the component is stopped.
+     *
+     * @param FilePath  Absolute path to a WAV file on disk
+     * @return          The component playing the clip, or nullptr on failure
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Pool")
+    UAudioComponent* AuditionWavFromFile(const FString& FilePath);
+
+    /**
+     * Hand a sound wave obtained from this actor back for reuse.
+     * Any playback of it on this actor's components is stopped and its queued audio is
+     * cleared; the caller must stop any other use of it first and not use it afterwards.
+     * Waves that are already released, or did not come from this actor, are ignored.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Pool")
+    void ReleaseSoundWave(USoundWaveProcedural* SoundWave);
+
     // -----------------------------------------------------------------
     // Stored results (optional — for Blueprint access after batch load)
     // -----------------------------------------------------------------
 
-    /** All sounds loaded by the most recent LoadWavsFromFolder call */
+    /** All sounds loaded by the most recent LoadWavsFromFolder call; owned by the caller until released */
     UPROPERTY(BlueprintReadOnly, Category = "Audio|Runtime")
     TArray<USoundWaveProcedural*> LoadedSounds;
 
@@ -79,6 +208,13 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Audio|Runtime")
     TArray<FString> LoadedFilePaths;
 
+    /**
+     * Release every sound in LoadedSounds back to the pool and clear both arrays.
+     * Only call this once nothing else (e.g. a queue the sounds were handed to) still plays them.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Pool")
+    void ReleaseLoadedSounds();
+
 protected:
     virtual void BeginPlay() override;
 
@@ -86,7 +222,72 @@ protected:
     UPROPERTY()
     USoundWaveProcedural* ProceduralSoundWave;
 
+    /** Idle sound waves, reset and ready to be refilled */
+    UPROPERTY()
+    TArray<USoundWaveProcedural*> FreeSoundWaves;
+
+    /** Idle audio components, registered and stopped */
+    UPROPERTY()
+    TArray<UAudioComponent*> FreeAudioComponents;
+
+    /** Sound waves handed out by AcquireSoundWave() and not yet released; weak so dropped waves can be collected */
+    TSet<TWeakObjectPtr<USoundWaveProcedural>> InUseSoundWaves;
+
+    /** Audition component currently playing each pooled sound wave */
+    UPROPERTY()
+    TMap<USoundWaveProcedural*, UAudioComponent*> SoundWaveComponents;
+
 private:
+    /** Memory-mapped bank loaded by LoadSoundBank() */
+    FRuntimeSoundBank SoundBank;
+
+    /** Collect WAV file paths under a folder, sorted */
+    void FindWavFiles(const FString& AudioFolderPath, bool bRecursive, TArray<FString>& OutFiles) const;
+
+    /** Read, parse and convert a WAV file to 16-bit PCM */
+    bool LoadWavAs16Bit(const FString& FilePath, TArray<uint8>& OutPCM16,
+                        int32& OutSampleRate, int32& OutNumChannels);
+
+    /** Run activity detection over already-loaded 16-bit PCM, then store and persist the index */
+    void DetectActivity(const FString& FilePath, const TArray<uint8>& PCM16, int32 SampleRate, int32 NumChannels);
+
+    /** Run activity detection by streaming a WAV file block by block, then store and persist the index */
+    bool DetectActivityFromFile(const FString& FilePath);
+
+    /** Log, save and remember a freshly built activity index */
+    void StoreActivityIndex(const FString& FilePath, FActivityIndex&& Index);
+
+    /** Look up an index from this session or a sidecar built with the current settings, without detecting */
+    bool FindActivityIndex(const FString& FilePath, FActivityIndex& OutIndex);
+
+    /** Forget this session's indices if ActivityDetection has changed since they were built */
+    void DiscardStaleActivityIndices();
+
+    /** ActivityDetection as it was when the entries in ActivityIndices were built */
+    FActivityDetectionSettings ActivityIndicesSettings;
+
+    /** Take a sound wave from the pool, or create one if the pool is empty */
+    USoundWaveProcedural* AcquireSoundWave();
+
+    /** Take an audio component from the pool, or create one if the pool is empty */
+    UAudioComponent* AcquireAudioComponent();
+
+    /** Create and register an idle audio component attached to this actor */
+    UAudioComponent* CreatePooledAudioComponent();
+
+    /** Stop a pooled audio component and return it to the pool */
+    void ReleaseAudioComponent(UAudioComponent* Component);
+
+    /** Returns a pooled component and its sound to their pools when playback ends */
+    void OnPooledAudioFinished(UAudioComponent* Component);
+
+    /** Play a sound on AudioComponent, returning the previously playing sound to the pool */
+    void PlayOnAudioComponent(USoundWaveProcedural* SoundWave);
+
+    /** Take a sound wave from the pool and queue 16-bit PCM into it */
+    USoundWaveProcedural* CreateProceduralSoundWave(const uint8* PCMData, int32 NumBytes,
+                                                    int32 SampleRate, int32 NumChannels);
+
     /** Parse a WAV file by scanning for fmt and data chunks */
     bool ParseWavFile(const TArray<uint8>& RawFileData, TArray<uint8>& OutPCMData,
                       int32& OutSampleRate, int32& OutNumChannels, int32& OutBitsPerSample);
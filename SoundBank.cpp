@@ -0,0 +1,346 @@
+#include "SoundBank.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+
+namespace
+{
+    /** Byte-wise ordering used both to sort the index at pack time and to search it at runtime */
+    int32 CompareClipPaths(const ANSICHAR* A, int32 LengthA, const ANSICHAR* B, int32 LengthB)
+    {
+        const int32 Cmp = FMemory::Memcmp(A, B, FMath::Min(LengthA, LengthB));
+        return Cmp != 0 ? Cmp : LengthA - LengthB;
+    }
+
+    /** True if [Offset, Offset + Size) lies within [0, Limit), without risking overflow in the sum */
+    bool IsRangeInBounds(uint64 Offset, uint64 Size, uint64 Limit)
+    {
+        return Offset <= Limit && Size <= Limit - Offset;
+    }
+}
+
+// =============================================================================
+// Writer
+// =============================================================================
+FSoundBankWriter::~FSoundBankWriter()
+{
+    if (Writer)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SoundBank: Writer for %s destroyed before Finalize(), bank was not written"), *FilePath);
+        delete Writer;
+        Writer = nullptr;
+        IFileManager::Get().Delete(*GetTempFilePath());
+    }
+}
+
+bool FSoundBankWriter::Open(const FString& BankFilePath)
+{
+    check(!Writer);
+
+    FilePath = BankFilePath;
+
+    // Written beside the destination and moved over it by Finalize(), so a failed pack
+    // never replaces a good bank
+    Writer = IFileManager::Get().CreateFileWriter(*GetTempFilePath());
+    if (!Writer)
+    {
+        UE_LOG(LogTemp, Error, TEXT("SoundBank: Could not create bank file: %s"), *GetTempFilePath());
+        return false;
+    }
+
+    Entries.Reset();
+    AddedPaths.Reset();
+
+    // Placeholder header — patched once the index location is known
+    FSoundBankHeader Header;
+    FMemory::Memzero(Header);
+    Writer->Serialize(&Header, sizeof(Header));
+
+    return true;
+}
+
+bool FSoundBankWriter::AddClip(const FString& ClipPath, int32 SampleRate, int32 NumChannels, const TArray<uint8>& PCM16Data)
+{
+    if (!Writer)
+    {
+        return false;
+    }
+
+    const FString NormalizedPath = FRuntimeSoundBank::NormalizeClipPath(ClipPath);
+    if (NormalizedPath.IsEmpty() || SampleRate <= 0 || NumChannels <= 0 || NumChannels > MAX_uint16)
+    {
+        UE_LOG(LogTemp, Error, TEXT("SoundBank: Invalid clip '%s' (%d Hz, %d ch)"), *ClipPath, SampleRate, NumChannels);
+        return false;
+    }
+
+    if (AddedPaths.Contains(NormalizedPath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SoundBank: Duplicate clip path skipped: %s"), *NormalizedPath);
+        return false;
+    }
+
+    // Every blob starts on a page boundary so the mapped view is page-aligned
+    PadToAlignment(FRuntimeSoundBank::PageSize);
+
+    FPendingEntry& Pending = Entries.AddDefaulted_GetRef();
+    FTCHARToUTF8 PathUTF8(*NormalizedPath);
+    Pending.PathUTF8.Append(PathUTF8.Get(), PathUTF8.Length());
+
+    FMemory::Memzero(Pending.Entry);
+    Pending.Entry.SampleRate    = SampleRate;
+    Pending.Entry.NumChannels   = NumChannels;
+    Pending.Entry.BitsPerSample = 16;
+    Pending.Entry.DataOffset    = Writer->Tell();
+    Pending.Entry.DataSize      = PCM16Data.Num();
+
+    Writer->Serialize(const_cast<uint8*>(PCM16Data.GetData()), PCM16Data.Num());
+    AddedPaths.Add(NormalizedPath);
+
+    return !Writer->IsError();
+}
+
+bool FSoundBankWriter::Finalize()
+{
+    if (!Writer)
+    {
+        return false;
+    }
+
+    // Sorted index so the runtime can binary-search it in place
+    Entries.Sort([](const FPendingEntry& A, const FPendingEntry& B)
+    {
+        return CompareClipPaths(A.PathUTF8.GetData(), A.PathUTF8.Num(), B.PathUTF8.GetData(), B.PathUTF8.Num()) < 0;
+    });
+
+    TArray<ANSICHAR> StringTable;
+    for (FPendingEntry& Pending : Entries)
+    {
+        Pending.Entry.PathOffset = StringTable.Num();
+        Pending.Entry.PathLength = Pending.PathUTF8.Num();
+        StringTable.Append(Pending.PathUTF8);
+    }
+
+    PadToAlignment(alignof(FSoundBankEntry));
+
+    FSoundBankHeader Header;
+    FMemory::Memzero(Header);
+    Header.Magic    = FRuntimeSoundBank::Magic;
+    Header.Version  = FRuntimeSoundBank::Version;
+    Header.NumClips = Entries.Num();
+    Header.PageSize = FRuntimeSoundBank::PageSize;
+
+    Header.IndexOffset = Writer->Tell();
+    for (FPendingEntry& Pending : Entries)
+    {
+        Writer->Serialize(&Pending.Entry, sizeof(FSoundBankEntry));
+    }
+
+    Header.StringsOffset = Writer->Tell();
+    Header.StringsSize   = StringTable.Num();
+    Writer->Serialize(StringTable.GetData(), StringTable.Num());
+
+    Writer->Seek(0);
+    Writer->Serialize(&Header, sizeof(Header));
+
+    const bool bSuccess = Writer->Close() && !Writer->IsError();
+    delete Writer;
+    Writer = nullptr;
+
+    if (!bSuccess)
+    {
+        UE_LOG(LogTemp, Error, TEXT("SoundBank: Failed writing bank file: %s"), *GetTempFilePath());
+        IFileManager::Get().Delete(*GetTempFilePath());
+        return false;
+    }
+
+    if (!IFileManager::Get().Move(*FilePath, *GetTempFilePath(), true))
+    {
+        UE_LOG(LogTemp, Error, TEXT("SoundBank: Could not replace bank file: %s"), *FilePath);
+        IFileManager::Get().Delete(*GetTempFilePath());
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("SoundBank: Wrote %d clips to %s"), Entries.Num(), *FilePath);
+    return true;
+}
+
+void FSoundBankWriter::PadToAlignment(uint32 Alignment)
+{
+    static const uint8 Zeros[FRuntimeSoundBank::PageSize] = {};
+
+    const int64 Position = Writer->Tell();
+    const int64 Padding = Align(Position, (int64)Alignment) - Position;
+    if (Padding > 0)
+    {
+        Writer->Serialize(const_cast<uint8*>(Zeros), Padding);
+    }
+}
+
+// =============================================================================
+// Memory-mapped reader
+// =============================================================================
+FRuntimeSoundBank::FRuntimeSoundBank()
+{
+}
+
+FRuntimeSoundBank::~FRuntimeSoundBank()
+{
+    Close();
+}
+
+bool FRuntimeSoundBank::Open(const FString& BankFilePath)
+{
+    Close();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    MappedHandle.Reset(PlatformFile.OpenMapped(*BankFilePath));
+    if (!MappedHandle.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("SoundBank: Could not open bank for mapping: %s"), *BankFilePath);
+        return false;
+    }
+
+    const int64 FileSize = MappedHandle->GetFileSize();
+    if (FileSize < (int64)sizeof(FSoundBankHeader))
+    {
+        UE_LOG(LogTemp, Error, TEXT("SoundBank: Bank file too small: %s"), *BankFilePath);
+        Close();
+        return false;
+    }
+
+    MappedRegion.Reset(MappedHandle->MapRegion(0, FileSize));
+    if (!MappedRegion.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("SoundBank: Failed to map bank: %s"), *BankFilePath);
+        Close();
+        return false;
+    }
+
+    MappedData = MappedRegion->GetMappedPtr();
+    const uint64 MappedSize = MappedRegion->GetMappedSize();
+
+    FSoundBankHeader Header;
+    FMemory::Memcpy(&Header, MappedData, sizeof(Header));
+
+    if (Header.Magic != Magic || Header.Version != Version)
+    {
+        UE_LOG(LogTemp, Error, TEXT("SoundBank: Not a sound bank or unsupported version (%u): %s"), Header.Version, *BankFilePath);
+        Close();
+        return false;
+    }
+
+    const uint64 IndexSize = (uint64)Header.NumClips * sizeof(FSoundBankEntry);
+    if (Header.NumClips > (uint32)MAX_int32 ||
+        Header.IndexOffset % alignof(FSoundBankEntry) != 0 ||
+        !IsRangeInBounds(Header.IndexOffset, IndexSize, MappedSize) ||
+        !IsRangeInBounds(Header.StringsOffset, Header.StringsSize, MappedSize))
+    {
+        UE_LOG(LogTemp, Error, TEXT("SoundBank: Corrupt index in %s"), *BankFilePath);
+        Close();
+        return false;
+    }
+
+    Entries = reinterpret_cast<const FSoundBankEntry*>(MappedData + Header.IndexOffset);
+    Strings = reinterpret_cast<const ANSICHAR*>(MappedData + Header.StringsOffset);
+    NumClips = Header.NumClips;
+
+    // Validate once up front so lookups can hand out views without bounds checks
+    for (int32 Index = 0; Index < NumClips; Index++)
+    {
+        const FSoundBankEntry& Entry = Entries[Index];
+        if (!IsRangeInBounds(Entry.PathOffset, Entry.PathLength, Header.StringsSize) ||
+            !IsRangeInBounds(Entry.DataOffset, Entry.DataSize, MappedSize) ||
+            Entry.DataSize > (uint64)MAX_int32 ||
+            Entry.BitsPerSample != 16 || Entry.NumChannels == 0 || Entry.SampleRate == 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("SoundBank: Corrupt entry %d in %s"), Index, *BankFilePath);
+            Close();
+            return false;
+        }
+    }
+
+    FilePath = BankFilePath;
+
+    UE_LOG(LogTemp, Log, TEXT("SoundBank: Mapped %s (%d clips, %lld bytes)"), *BankFilePath, NumClips, FileSize);
+    return true;
+}
+
+void FRuntimeSoundBank::Close()
+{
+    // Region must be released before the handle that owns it
+    MappedRegion.Reset();
+    MappedHandle.Reset();
+
+    FilePath.Empty();
+    MappedData = nullptr;
+    Entries = nullptr;
+    Strings = nullptr;
+    NumClips = 0;
+}
+
+bool FRuntimeSoundBank::FindClip(const FString& ClipPath, FSoundBankClipView& OutClip) const
+{
+    if (!IsOpen())
+    {
+        return false;
+    }
+
+    FTCHARToUTF8 Query(*NormalizeClipPath(ClipPath));
+
+    // Lower-bound binary search over the mapped index
+    int32 Low = 0;
+    int32 High = NumClips;
+    while (Low < High)
+    {
+        const int32 Mid = Low + (High - Low) / 2;
+        const FSoundBankEntry& Entry = Entries[Mid];
+        if (CompareClipPaths(Strings + Entry.PathOffset, Entry.PathLength, Query.Get(), Query.Length()) < 0)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+
+    if (Low >= NumClips)
+    {
+        return false;
+    }
+
+    const FSoundBankEntry& Entry = Entries[Low];
+    if (CompareClipPaths(Strings + Entry.PathOffset, Entry.PathLength, Query.Get(), Query.Length()) != 0)
+    {
+        return false;
+    }
+
+    OutClip.PCMData     = TArrayView<const uint8>(MappedData + Entry.DataOffset, (int32)Entry.DataSize);
+    OutClip.SampleRate  = Entry.SampleRate;
+    OutClip.NumChannels = Entry.NumChannels;
+    return true;
+}
+
+void FRuntimeSoundBank::GetClipPaths(TArray<FString>& OutPaths) const
+{
+    OutPaths.Reset(NumClips);
+
+    for (int32 Index = 0; Index < NumClips; Index++)
+    {
+        const FSoundBankEntry& Entry = Entries[Index];
+        FUTF8ToTCHAR Converted(Strings + Entry.PathOffset, Entry.PathLength);
+        OutPaths.Emplace(Converted.Length(), Converted.Get());
+    }
+}
+
+FString FRuntimeSoundBank::NormalizeClipPath(const FString& ClipPath)
+{
+    FString Result = ClipPath;
+    FPaths::NormalizeFilename(Result);
+    while (Result.RemoveFromStart(TEXT("/")))
+    {
+    }
+    return Result;
+}
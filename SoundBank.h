@@ -0,0 +1,142 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FArchive;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Packed sound bank file layout (all values little-endian):
+ *
+ *   [FSoundBankHeader]
+ *   [padding to PageSize]
+ *   [clip 0 PCM][padding to PageSize][clip 1 PCM]...   16-bit PCM, each blob page-aligned
+ *   [FSoundBankEntry x NumClips]                       sorted by path (byte-wise UTF-8)
+ *   [string table]                                     UTF-8 clip paths, not null-terminated
+ *
+ * Clip paths are relative to the folder that was packed, using '/' separators.
+ */
+struct FSoundBankHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    uint32 NumClips;
+    uint32 PageSize;
+    uint64 IndexOffset;
+    uint64 StringsOffset;
+    uint64 StringsSize;
+};
+
+struct FSoundBankEntry
+{
+    uint32 PathOffset;      // Offset into the string table
+    uint32 PathLength;      // Length in bytes
+    uint32 SampleRate;
+    uint16 NumChannels;
+    uint16 BitsPerSample;   // Always 16 — blobs are pre-converted by the packer
+    uint64 DataOffset;      // Absolute file offset, multiple of PageSize
+    uint64 DataSize;        // Bytes of PCM
+};
+
+static_assert(sizeof(FSoundBankHeader) == 40, "FSoundBankHeader layout must match the on-disk format");
+static_assert(sizeof(FSoundBankEntry) == 32, "FSoundBankEntry layout must match the on-disk format");
+
+/** A clip served straight out of the mapped bank. Valid for as long as the bank stays open. */
+struct FSoundBankClipView
+{
+    TArrayView<const uint8> PCMData;
+    int32 SampleRate = 0;
+    int32 NumChannels = 0;
+};
+
+/**
+ * Offline writer for packed sound banks.
+ * Clips are streamed to disk as they are added; the sorted index is written by Finalize().
+ */
+class TEST_API FSoundBankWriter
+{
+public:
+    ~FSoundBankWriter();
+
+    /** Start a bank file. Any existing file at BankFilePath is only replaced once Finalize() succeeds. */
+    bool Open(const FString& BankFilePath);
+
+    /** Append one clip of 16-bit PCM. ClipPath must be unique within the bank. */
+    bool AddClip(const FString& ClipPath, int32 SampleRate, int32 NumChannels, const TArray<uint8>& PCM16Data);
+
+    /** Write the index and header, close the file and move it into place */
+    bool Finalize();
+
+    int32 GetNumClips() const { return Entries.Num(); }
+
+private:
+    struct FPendingEntry
+    {
+        TArray<ANSICHAR> PathUTF8;
+        FSoundBankEntry Entry;
+    };
+
+    /** Paths are compared byte-wise everywhere else, so duplicates must be detected case-sensitively too */
+    struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<FString, FString>
+    {
+        static const FString& GetSetKey(const FString& Element) { return Element; }
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+    };
+
+    void PadToAlignment(uint32 Alignment);
+
+    FString GetTempFilePath() const { return FilePath + TEXT(".tmp"); }
+
+    FArchive* Writer = nullptr;
+    FString FilePath;
+    TArray<FPendingEntry> Entries;
+    TSet<FString, FCaseSensitiveKeyFuncs> AddedPaths;
+};
+
+/**
+ * Read-only, memory-mapped view of a packed sound bank.
+ * Opening a bank maps the whole file once; clip lookups are a binary search over the
+ * mapped index and return views into the mapping without copying or parsing anything.
+ */
+class TEST_API FRuntimeSoundBank
+{
+public:
+    FRuntimeSoundBank();
+    ~FRuntimeSoundBank();
+
+    /** Map a bank file and validate its header and index */
+    bool Open(const FString& BankFilePath);
+
+    /** Unmap the bank. Any outstanding clip views become invalid. */
+    void Close();
+
+    bool IsOpen() const { return MappedRegion.IsValid(); }
+
+    int32 GetNumClips() const { return NumClips; }
+
+    /** Look up a clip by its bank-relative path */
+    bool FindClip(const FString& ClipPath, FSoundBankClipView& OutClip) const;
+
+    /** All clip paths in index order */
+    void GetClipPaths(TArray<FString>& OutPaths) const;
+
+    /** Normalize a path the same way the packer does ('/' separators, no leading slash) */
+    static FString NormalizeClipPath(const FString& ClipPath);
+
+    static constexpr uint32 Magic = 0x42535452; // 'RTSB'
+    static constexpr uint32 Version = 1;
+    static constexpr uint32 PageSize = 4096;
+
+private:
+    TUniquePtr<IMappedFileHandle> MappedHandle;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    FString FilePath;
+
+    /** Pointers into the mapping, set up by Open() */
+    const uint8* MappedData = nullptr;
+    const FSoundBankEntry* Entries = nullptr;
+    const ANSICHAR* Strings = nullptr;
+    int32 NumClips = 0;
+};
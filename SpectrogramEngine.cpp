@@ -0,0 +1,658 @@
+#include "SpectrogramEngine.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "DSP/Dsp.h"
+#include "DSP/FFTAlgorithm.h"
+#include "DSP/FloatArrayMath.h"
+#include "Engine/Texture2D.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Compression.h"
+#include <atomic>
+
+namespace
+{
+    constexpr uint32 SpectrogramCacheMagic = 0x50535452; // 'RTSP'
+    constexpr uint32 SpectrogramCacheVersion = 2;
+
+    /** Columns handed to each ParallelFor task */
+    constexpr int32 ColumnsPerBlock = 16;
+
+    struct FSpectrogramCacheHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        int32 FFTSize;
+        int32 TileWidth;
+        float MinDecibels;
+        float MaxDecibels;
+        int64 SourceFileSize;
+        int64 SourceTimeStamp;
+    };
+
+    /** Precedes each zlib-compressed tile appended to the cache */
+    struct FSpectrogramTileRecord
+    {
+        int32 Level;
+        int32 TileIndex;
+        int32 CompressedSize;
+        int32 UncompressedSize;
+    };
+
+    /** FFT plan and scratch buffers, set up once per ParallelFor worker and reused for all its columns */
+    struct FFFTWorkerContext
+    {
+        TUniquePtr<Audio::IFFTAlgorithm> FFT;
+        Audio::FAlignedFloatBuffer Windowed;
+        Audio::FAlignedFloatBuffer Spectrum;
+        Audio::FAlignedFloatBuffer Power;
+    };
+}
+
+USpectrogramEngine::USpectrogramEngine()
+    : FFTSize(1024)
+    , TileWidth(256)
+    , MinDecibels(-100.0f)
+    , MaxDecibels(0.0f)
+    , LastGeneration(0)
+    , CacheGeneration(0)
+{
+}
+
+void USpectrogramEngine::BeginDestroy()
+{
+    // Running tile builds see the file as closed and stop at their next read
+    Close();
+    Super::BeginDestroy();
+}
+
+bool USpectrogramEngine::IsReadyForFinishDestroy()
+{
+    return Super::IsReadyForFinishDestroy() && NumPendingRequests.GetValue() == 0;
+}
+
+bool USpectrogramEngine::Open(const FString& WavFilePath, const FString& CacheFilePath)
+{
+    Close();
+
+    if (FFTSize < 64 || FFTSize > 16384 || !FMath::IsPowerOfTwo(FFTSize) || TileWidth <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Spectrogram: Invalid settings (FFTSize %d, TileWidth %d)"), FFTSize, TileWidth);
+        return false;
+    }
+
+    TSharedRef<FOpenState, ESPMode::ThreadSafe> State = MakeShared<FOpenState, ESPMode::ThreadSafe>();
+    State->FFTSize     = FFTSize;
+    State->TileWidth   = TileWidth;
+    State->MinDecibels = MinDecibels;
+    State->MaxDecibels = MaxDecibels;
+
+    // Hann window, normalized so a full-scale sine peaks at 0 dB
+    State->Window.SetNumUninitialized(FFTSize);
+    float WindowSum = 0.0f;
+    for (int32 Index = 0; Index < FFTSize; Index++)
+    {
+        State->Window[Index] = 0.5f - 0.5f * FMath::Cos(2.0f * PI * Index / FFTSize);
+        WindowSum += State->Window[Index];
+    }
+    State->PowerScale = 4.0f / (WindowSum * WindowSum);
+
+    {
+        FScopeLock ReaderScope(&ReaderLock);
+
+        if (!Reader.Open(WavFilePath))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Spectrogram: Failed to open WAV: %s"), *WavFilePath);
+            return false;
+        }
+
+        State->Generation = ++LastGeneration;
+        State->NumFrames  = Reader.GetNumFrames();
+        State->SampleRate = Reader.GetSampleRate();
+
+        // Levels until a single tile covers the whole file
+        const int64 TotalColumns = FMath::Max<int64>(FMath::DivideAndRoundUp<int64>(State->NumFrames, State->GetHopSize()), 1);
+        State->NumLevels = 1;
+        while (FMath::DivideAndRoundUp<int64>(TotalColumns, (int64)State->TileWidth << (State->NumLevels - 1)) > 1)
+        {
+            State->NumLevels++;
+        }
+
+        OpenState = State;
+    }
+
+    WavPath = WavFilePath;
+    CachePath = CacheFilePath.IsEmpty() ? WavFilePath + TEXT(".spectrogram") : CacheFilePath;
+
+    // A missing cache only costs recomputation, so it is not fatal
+    if (!OpenCache(*State))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Spectrogram: Tile cache unavailable, tiles will not be persisted: %s"), *CachePath);
+    }
+
+    int32 NumCachedTiles = 0;
+    {
+        FScopeLock CacheScope(&CacheLock);
+        NumCachedTiles = CachedTiles.Num();
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Spectrogram: Opened %s (%.1fs, %d levels, %d cached tiles)"),
+           *WavPath, GetDuration(), State->NumLevels, NumCachedTiles);
+    return true;
+}
+
+void USpectrogramEngine::Close()
+{
+    FScopeLock ReaderScope(&ReaderLock);
+    FScopeLock CacheScope(&CacheLock);
+
+    Reader.Close();
+    OpenState.Reset();
+    CacheFile.Reset();
+    CachedTiles.Empty();
+    PendingTiles.Empty();
+    CacheGeneration = 0;
+    WavPath.Empty();
+    CachePath.Empty();
+}
+
+USpectrogramEngine::FOpenStatePtr USpectrogramEngine::GetOpenState() const
+{
+    FScopeLock ReaderScope(&ReaderLock);
+    return OpenState;
+}
+
+bool USpectrogramEngine::IsCurrentGeneration(uint32 Generation) const
+{
+    FScopeLock ReaderScope(&ReaderLock);
+    return OpenState.IsValid() && OpenState->Generation == Generation;
+}
+
+int32 USpectrogramEngine::FOpenState::GetNumTiles(int32 Level) const
+{
+    if (Level < 0 || Level >= NumLevels)
+    {
+        return 0;
+    }
+
+    return (int32)FMath::Max<int64>(FMath::DivideAndRoundUp<int64>(NumFrames, GetFramesPerTile(Level)), 1);
+}
+
+bool USpectrogramEngine::IsOpen() const
+{
+    return GetOpenState().IsValid();
+}
+
+int32 USpectrogramEngine::GetNumLevels() const
+{
+    const FOpenStatePtr State = GetOpenState();
+    return State.IsValid() ? State->NumLevels : 0;
+}
+
+int32 USpectrogramEngine::GetNumTiles(int32 Level) const
+{
+    const FOpenStatePtr State = GetOpenState();
+    return State.IsValid() ? State->GetNumTiles(Level) : 0;
+}
+
+int32 USpectrogramEngine::GetNumBins() const
+{
+    const FOpenStatePtr State = GetOpenState();
+    return State.IsValid() ? State->GetNumBins() : 0;
+}
+
+int32 USpectrogramEngine::GetTileWidth() const
+{
+    const FOpenStatePtr State = GetOpenState();
+    return State.IsValid() ? State->TileWidth : 0;
+}
+
+float USpectrogramEngine::GetTileDuration(int32 Level) const
+{
+    const FOpenStatePtr State = GetOpenState();
+    if (!State.IsValid() || Level < 0 || Level >= State->NumLevels)
+    {
+        return 0.0f;
+    }
+
+    return (float)((double)State->GetFramesPerTile(Level) / State->SampleRate);
+}
+
+float USpectrogramEngine::GetDuration() const
+{
+    const FOpenStatePtr State = GetOpenState();
+    return State.IsValid() ? (float)((double)State->NumFrames / State->SampleRate) : 0.0f;
+}
+
+// =============================================================================
+// Tile access
+// =============================================================================
+bool USpectrogramEngine::IsTileReady(int32 Level, int32 TileIndex) const
+{
+    const FOpenStatePtr State = GetOpenState();
+    if (!State.IsValid())
+    {
+        return false;
+    }
+
+    FScopeLock CacheScope(&CacheLock);
+    return CacheGeneration == State->Generation && CachedTiles.Contains(MakeTileKey(Level, TileIndex));
+}
+
+bool USpectrogramEngine::RequestTile(int32 Level, int32 TileIndex)
+{
+    check(IsInGameThread());
+
+    const FOpenStatePtr State = GetOpenState();
+    if (!State.IsValid() || TileIndex < 0 || TileIndex >= State->GetNumTiles(Level))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Spectrogram: Tile %d at level %d is out of range"), TileIndex, Level);
+        return false;
+    }
+
+    const uint64 TileKey = MakeTileKey(Level, TileIndex);
+    {
+        FScopeLock CacheScope(&CacheLock);
+
+        if (CacheGeneration == State->Generation && CachedTiles.Contains(TileKey))
+        {
+            return true;
+        }
+
+        if (PendingTiles.Contains(TileKey))
+        {
+            return false;
+        }
+
+        PendingTiles.Add(TileKey);
+    }
+
+    // IsReadyForFinishDestroy() holds off destruction until this count drops, so the task may use 'this'
+    NumPendingRequests.Increment();
+
+    TWeakObjectPtr<USpectrogramEngine> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [this, WeakThis, State, Level, TileIndex, TileKey]()
+    {
+        TArray<uint8> Magnitudes;
+        const bool bSuccess = LoadOrBuildTile(*State, Level, TileIndex, Magnitudes);
+
+        {
+            FScopeLock CacheScope(&CacheLock);
+            if (CacheGeneration == State->Generation)
+            {
+                PendingTiles.Remove(TileKey);
+            }
+        }
+
+        const uint32 Generation = State->Generation;
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Generation, Level, TileIndex, bSuccess]()
+        {
+            // Tiles of a file that has since been closed are not reported
+            USpectrogramEngine* Engine = WeakThis.Get();
+            if (Engine && Engine->IsCurrentGeneration(Generation))
+            {
+                Engine->OnTileReady.Broadcast(Level, TileIndex, bSuccess);
+            }
+        });
+
+        NumPendingRequests.Decrement();
+    });
+
+    return false;
+}
+
+bool USpectrogramEngine::GetTileData(int32 Level, int32 TileIndex, TArray<uint8>& OutMagnitudes)
+{
+    const FOpenStatePtr State = GetOpenState();
+    if (!State.IsValid())
+    {
+        return false;
+    }
+
+    return LoadOrBuildTile(*State, Level, TileIndex, OutMagnitudes);
+}
+
+bool USpectrogramEngine::LoadOrBuildTile(const FOpenState& State, int32 Level, int32 TileIndex, TArray<uint8>& OutMagnitudes)
+{
+    if (TileIndex < 0 || TileIndex >= State.GetNumTiles(Level))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Spectrogram: Tile %d at level %d is out of range"), TileIndex, Level);
+        return false;
+    }
+
+    const uint64 TileKey = MakeTileKey(Level, TileIndex);
+    if (ReadCachedTile(State, TileKey, OutMagnitudes))
+    {
+        return true;
+    }
+
+    const bool bBuilt = Level == 0
+        ? ComputeBaseTile(State, TileIndex, OutMagnitudes)
+        : BuildParentTile(State, Level, TileIndex, OutMagnitudes);
+
+    if (!bBuilt)
+    {
+        return false;
+    }
+
+    WriteCachedTile(State, TileKey, OutMagnitudes);
+    return true;
+}
+
+UTexture2D* USpectrogramEngine::GetTileTexture(int32 Level, int32 TileIndex)
+{
+    check(IsInGameThread());
+
+    const FOpenStatePtr State = GetOpenState();
+    TArray<uint8> Magnitudes;
+    if (!State.IsValid() || !LoadOrBuildTile(*State, Level, TileIndex, Magnitudes))
+    {
+        return nullptr;
+    }
+
+    UTexture2D* Texture = UTexture2D::CreateTransient(State->TileWidth, State->GetNumBins(), PF_G8);
+    if (!Texture)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Spectrogram: Failed to create tile texture"));
+        return nullptr;
+    }
+
+    Texture->SRGB = false;
+
+    FTexture2DMipMap& Mip = Texture->GetPlatformData()->Mips[0];
+    void* MipData = Mip.BulkData.Lock(LOCK_READ_WRITE);
+    FMemory::Memcpy(MipData, Magnitudes.GetData(), Magnitudes.Num());
+    Mip.BulkData.Unlock();
+
+    Texture->UpdateResource();
+    return Texture;
+}
+
+// =============================================================================
+// STFT
+// =============================================================================
+bool USpectrogramEngine::ComputeBaseTile(const FOpenState& State, int32 TileIndex, TArray<uint8>& OutMagnitudes)
+{
+    const int32 FFTLength = State.FFTSize;
+    const int32 Width = State.TileWidth;
+    const int32 HopSize = State.GetHopSize();
+    const int32 NumBins = State.GetNumBins();
+
+    TArray<float> Samples;
+    {
+        FScopeLock ReaderScope(&ReaderLock);
+
+        // The reader may have been closed or reopened on another file since the request began
+        if (!OpenState.IsValid() || OpenState->Generation != State.Generation)
+        {
+            return false;
+        }
+
+        // Windows are centred on their column position; consecutive windows overlap,
+        // so the tile is one sequential read
+        const int64 FirstWindowStart = (int64)TileIndex * Width * HopSize - FFTLength / 2;
+        const int32 SpanFrames = (Width - 1) * HopSize + FFTLength;
+
+        Samples.SetNumUninitialized(SpanFrames);
+        if (!Reader.ReadMonoFloat(FirstWindowStart, SpanFrames, Samples.GetData()))
+        {
+            return false;
+        }
+    }
+
+    OutMagnitudes.SetNumUninitialized(NumBins * Width);
+
+    const int32 Log2Size = FMath::FloorLog2(FFTLength);
+    const float DecibelRange = FMath::Max(State.MaxDecibels - State.MinDecibels, UE_KINDA_SMALL_NUMBER);
+    const int32 NumBlocks = FMath::DivideAndRoundUp(Width, ColumnsPerBlock);
+    std::atomic<bool> bFailed(false);
+
+    TArray<FFFTWorkerContext> WorkerContexts;
+    ParallelForWithTaskContext(WorkerContexts, NumBlocks, [&](FFFTWorkerContext& Context, int32 BlockIndex)
+    {
+        if (!Context.FFT.IsValid())
+        {
+            Audio::FFFTSettings Settings;
+            Settings.Log2Size = Log2Size;
+            Settings.bArrays128BitAligned = true;
+            Settings.bEnableHardwareAcceleration = true;
+
+            Context.FFT = Audio::FFFTFactory::NewFFTAlgorithm(Settings);
+            if (!Context.FFT.IsValid())
+            {
+                bFailed = true;
+                return;
+            }
+
+            Context.Windowed.SetNumUninitialized(FFTLength);
+            Context.Spectrum.SetNumUninitialized(Context.FFT->NumOutputFloats());
+            Context.Power.SetNumUninitialized(Context.FFT->NumOutputFloats() / 2);
+        }
+
+        const int32 FirstColumn = BlockIndex * ColumnsPerBlock;
+        const int32 EndColumn = FMath::Min(FirstColumn + ColumnsPerBlock, Width);
+
+        for (int32 Column = FirstColumn; Column < EndColumn; Column++)
+        {
+            const float* WindowSamples = &Samples[Column * HopSize];
+
+            Audio::ArrayMultiply(MakeArrayView(WindowSamples, FFTLength), State.Window, Context.Windowed);
+            Context.FFT->ForwardRealToComplex(Context.Windowed.GetData(), Context.Spectrum.GetData());
+            Audio::ArrayComplexToPower(Context.Spectrum, Context.Power);
+
+            // Quantize to 8-bit dB, highest frequency in row 0
+            for (int32 Bin = 0; Bin < NumBins; Bin++)
+            {
+                const float Decibels = 10.0f * FMath::LogX(10.0f, FMath::Max(Context.Power[Bin] * State.PowerScale, 1e-20f));
+                const float Normalized = FMath::Clamp((Decibels - State.MinDecibels) / DecibelRange, 0.0f, 1.0f);
+                OutMagnitudes[(NumBins - 1 - Bin) * Width + Column] = (uint8)FMath::RoundToInt(Normalized * 255.0f);
+            }
+        }
+    });
+
+    if (bFailed)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Spectrogram: No FFT implementation available for size %d"), FFTLength);
+        return false;
+    }
+
+    return true;
+}
+
+bool USpectrogramEngine::BuildParentTile(const FOpenState& State, int32 Level, int32 TileIndex, TArray<uint8>& OutMagnitudes)
+{
+    const int32 Width = State.TileWidth;
+    const int32 NumBins = State.GetNumBins();
+    const int32 NumChildTiles = State.GetNumTiles(Level - 1);
+
+    // Parent column C covers child-level columns 2C and 2C + 1, which fall in child tiles
+    // 2 * TileIndex and 2 * TileIndex + 1. Children past the end of the file are silence.
+    TArray<uint8> Children[2];
+    for (int32 Child = 0; Child < 2; Child++)
+    {
+        const int32 ChildIndex = TileIndex * 2 + Child;
+        if (ChildIndex >= NumChildTiles)
+        {
+            Children[Child].SetNumZeroed(NumBins * Width);
+        }
+        else if (!LoadOrBuildTile(State, Level - 1, ChildIndex, Children[Child]))
+        {
+            return false;
+        }
+    }
+
+    OutMagnitudes.SetNumUninitialized(NumBins * Width);
+
+    for (int32 Column = 0; Column < Width; Column++)
+    {
+        // Source columns counted across both children laid end to end
+        const int32 SourceA = Column * 2;
+        const int32 SourceB = SourceA + 1;
+
+        const TArray<uint8>& TileA = Children[SourceA / Width];
+        const TArray<uint8>& TileB = Children[SourceB / Width];
+        const int32 ColumnA = SourceA % Width;
+        const int32 ColumnB = SourceB % Width;
+
+        for (int32 Row = 0; Row < NumBins; Row++)
+        {
+            OutMagnitudes[Row * Width + Column] = FMath::Max(TileA[Row * Width + ColumnA], TileB[Row * Width + ColumnB]);
+        }
+    }
+
+    return true;
+}
+
+// =============================================================================
+// On-disk tile cache
+// =============================================================================
+bool USpectrogramEngine::OpenCache(const FOpenState& State)
+{
+    FScopeLock CacheScope(&CacheLock);
+
+    // Requests for this open are tracked from here on, even if no cache file can be opened
+    CacheGeneration = State.Generation;
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    IFileManager& FileManager = IFileManager::Get();
+
+    FSpectrogramCacheHeader Expected;
+    FMemory::Memzero(Expected);
+    Expected.Magic           = SpectrogramCacheMagic;
+    Expected.Version         = SpectrogramCacheVersion;
+    Expected.FFTSize         = State.FFTSize;
+    Expected.TileWidth       = State.TileWidth;
+    Expected.MinDecibels     = State.MinDecibels;
+    Expected.MaxDecibels     = State.MaxDecibels;
+    Expected.SourceFileSize  = FileManager.FileSize(*WavPath);
+    Expected.SourceTimeStamp = FileManager.GetTimeStamp(*WavPath).GetTicks();
+
+    CacheFile.Reset(PlatformFile.OpenWrite(*CachePath, /*bAppend*/ true, /*bAllowRead*/ true));
+    if (!CacheFile.IsValid())
+    {
+        return false;
+    }
+
+    const int64 CacheSize = CacheFile->Size();
+    const int32 ExpectedTileSize = State.GetNumBins() * State.TileWidth;
+
+    FSpectrogramCacheHeader Header;
+    bool bCacheValid = CacheSize >= (int64)sizeof(Header) &&
+                       CacheFile->Seek(0) &&
+                       CacheFile->Read(reinterpret_cast<uint8*>(&Header), sizeof(Header)) &&
+                       FMemory::Memcmp(&Header, &Expected, sizeof(Header)) == 0;
+
+    if (bCacheValid)
+    {
+        // Index the tile records; a torn record at the end (e.g. after a crash) is cut off
+        int64 Offset = sizeof(Header);
+        while (Offset + (int64)sizeof(FSpectrogramTileRecord) <= CacheSize)
+        {
+            FSpectrogramTileRecord Record;
+            if (!CacheFile->Seek(Offset) || !CacheFile->Read(reinterpret_cast<uint8*>(&Record), sizeof(Record)))
+            {
+                break;
+            }
+
+            const int64 DataOffset = Offset + sizeof(Record);
+            if (Record.CompressedSize <= 0 || Record.UncompressedSize != ExpectedTileSize ||
+                DataOffset + Record.CompressedSize > CacheSize)
+            {
+                break;
+            }
+
+            CachedTiles.Add(MakeTileKey(Record.Level, Record.TileIndex), FCachedTile{ DataOffset, Record.CompressedSize });
+            Offset = DataOffset + Record.CompressedSize;
+        }
+
+        if (Offset != CacheSize && !CacheFile->Truncate(Offset))
+        {
+            bCacheValid = false;
+        }
+    }
+
+    if (!bCacheValid)
+    {
+        // Stale or foreign cache: start over
+        CachedTiles.Empty();
+        CacheFile.Reset(PlatformFile.OpenWrite(*CachePath, /*bAppend*/ false, /*bAllowRead*/ true));
+        if (!CacheFile.IsValid() || !CacheFile->Write(reinterpret_cast<const uint8*>(&Expected), sizeof(Expected)))
+        {
+            CacheFile.Reset();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool USpectrogramEngine::ReadCachedTile(const FOpenState& State, uint64 TileKey, TArray<uint8>& OutMagnitudes)
+{
+    FScopeLock CacheScope(&CacheLock);
+
+    if (CacheGeneration != State.Generation)
+    {
+        return false;
+    }
+
+    const FCachedTile* Tile = CachedTiles.Find(TileKey);
+    if (!Tile || !CacheFile.IsValid())
+    {
+        return false;
+    }
+
+    TArray<uint8> Compressed;
+    Compressed.SetNumUninitialized(Tile->CompressedSize);
+    if (!CacheFile->Seek(Tile->Offset) || !CacheFile->Read(Compressed.GetData(), Compressed.Num()))
+    {
+        return false;
+    }
+
+    OutMagnitudes.SetNumUninitialized(State.GetNumBins() * State.TileWidth);
+    if (!FCompression::UncompressMemory(NAME_Zlib, OutMagnitudes.GetData(), OutMagnitudes.Num(), Compressed.GetData(), Compressed.Num()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Spectrogram: Corrupt cached tile, recomputing"));
+        CachedTiles.Remove(TileKey);
+        return false;
+    }
+
+    return true;
+}
+
+void USpectrogramEngine::WriteCachedTile(const FOpenState& State, uint64 TileKey, const TArray<uint8>& Magnitudes)
+{
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Magnitudes.Num());
+    TArray<uint8> Compressed;
+    Compressed.SetNumUninitialized(CompressedSize);
+    if (!FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Magnitudes.GetData(), Magnitudes.Num()))
+    {
+        return;
+    }
+
+    FSpectrogramTileRecord Record;
+    Record.Level            = (int32)(TileKey >> 32);
+    Record.TileIndex        = (int32)(TileKey & 0xFFFFFFFF);
+    Record.CompressedSize   = CompressedSize;
+    Record.UncompressedSize = Magnitudes.Num();
+
+    FScopeLock CacheScope(&CacheLock);
+
+    // The file may have been closed or reopened since the tile was built, and another
+    // thread may have computed the same tile meanwhile
+    if (CacheGeneration != State.Generation || !CacheFile.IsValid() || CachedTiles.Contains(TileKey))
+    {
+        return;
+    }
+
+    if (!CacheFile->SeekFromEnd(0))
+    {
+        return;
+    }
+
+    const int64 RecordOffset = CacheFile->Tell();
+    if (CacheFile->Write(reinterpret_cast<const uint8*>(&Record), sizeof(Record)) &&
+        CacheFile->Write(Compressed.GetData(), CompressedSize))
+    {
+        CachedTiles.Add(TileKey, FCachedTile{ RecordOffset + (int64)sizeof(Record), CompressedSize });
+    }
+}
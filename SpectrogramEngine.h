@@ -0,0 +1,210 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "WavStreamReader.h"
+#include "SpectrogramEngine.generated.h"
+
+class UTexture2D;
+
+/** Fired on the game thread when a tile requested with RequestTile() is ready or has failed */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSpectrogramTileReady, int32, Level, int32, TileIndex, bool, bSuccess);
+
+/**
+ * Computes STFT magnitude spectrograms of WAV files as a pyramid of fixed-size tiles.
+ *
+ * Level 0 tiles are computed by STFT with one column per hop (FFTSize / 4 frames), reading
+ * only the frames the tile needs. Each coarser tile is the max-pool of its two child tiles,
+ * so short events stay visible at every zoom level.
+ *
+ * All tiles are appended to a compressed cache file next to the WAV, so panning and zooming
+ * only ever compute tiles that have not been seen before. The first view of a coarse level
+ * computes and caches everything beneath it, which for a long recording takes a while; views
+ * should call RequestTile(), which builds tiles on a background thread, and draw each tile
+ * once OnTileReady fires. Later views, including in later sessions, are served from the cache.
+ *
+ * Tile data is NumBins rows x TileWidth columns of 8-bit dB values, row 0 = highest frequency.
+ * The analysis settings are captured by Open(); changing the properties afterwards has no
+ * effect until the next Open().
+ * GetTileData() may be called from any thread and blocks until the tile is built.
+ * RequestTile() and GetTileTexture() must be called on the game thread.
+ *
+ * Requires the "SignalProcessing" module.
+ */
+UCLASS(BlueprintType)
+class TEST_API USpectrogramEngine : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    USpectrogramEngine();
+
+    virtual void BeginDestroy() override;
+    virtual bool IsReadyForFinishDestroy() override;
+
+    /** FFT window size in frames. Must be a power of two. Set before Open(). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Spectrogram")
+    int32 FFTSize;
+
+    /** Columns per tile. Set before Open(). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Spectrogram")
+    int32 TileWidth;
+
+    /** Level mapped to 0 in tile data. Set before Open(). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Spectrogram")
+    float MinDecibels;
+
+    /** Level mapped to 255 in tile data. Set before Open(). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio|Spectrogram")
+    float MaxDecibels;
+
+    /** Broadcast when a tile requested with RequestTile() has been built */
+    UPROPERTY(BlueprintAssignable, Category = "Audio|Spectrogram")
+    FOnSpectrogramTileReady OnTileReady;
+
+    /**
+     * Open a WAV file for spectrogram viewing.
+     * @param WavFilePath    Absolute path to a PCM WAV file
+     * @param CacheFilePath  Tile cache file; defaults to "<WavFilePath>.spectrogram" when empty.
+     *                       Discarded and rebuilt if the WAV or the settings changed.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Spectrogram")
+    bool Open(const FString& WavFilePath, const FString& CacheFilePath = TEXT(""));
+
+    /** Close the file. Tiles still being built for it are dropped and never reported. */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Spectrogram")
+    void Close();
+
+    UFUNCTION(BlueprintPure, Category = "Audio|Spectrogram")
+    bool IsOpen() const;
+
+    /** Number of zoom levels; the top level is a single tile covering the whole file */
+    UFUNCTION(BlueprintPure, Category = "Audio|Spectrogram")
+    int32 GetNumLevels() const;
+
+    UFUNCTION(BlueprintPure, Category = "Audio|Spectrogram")
+    int32 GetNumTiles(int32 Level) const;
+
+    /** Frequency rows per tile of the open file (FFTSize / 2, DC to just below Nyquist) */
+    UFUNCTION(BlueprintPure, Category = "Audio|Spectrogram")
+    int32 GetNumBins() const;
+
+    /** Columns per tile of the open file */
+    UFUNCTION(BlueprintPure, Category = "Audio|Spectrogram")
+    int32 GetTileWidth() const;
+
+    /** Seconds of audio covered by one tile at this level */
+    UFUNCTION(BlueprintPure, Category = "Audio|Spectrogram")
+    float GetTileDuration(int32 Level) const;
+
+    UFUNCTION(BlueprintPure, Category = "Audio|Spectrogram")
+    float GetDuration() const;
+
+    /** True if the tile is in the cache, so GetTileData() and GetTileTexture() return without computing */
+    UFUNCTION(BlueprintPure, Category = "Audio|Spectrogram")
+    bool IsTileReady(int32 Level, int32 TileIndex) const;
+
+    /**
+     * Make sure a tile is built without blocking the caller.
+     * @return  True if the tile is already cached. Otherwise it is built on a background thread
+     *          and OnTileReady fires when it is done; repeated requests for it are coalesced.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Spectrogram")
+    bool RequestTile(int32 Level, int32 TileIndex);
+
+    /**
+     * Get a tile's magnitudes, from the cache if present, otherwise computed and cached.
+     * @param OutMagnitudes  GetNumBins() * GetTileWidth() bytes, row-major, row 0 = highest frequency
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Spectrogram")
+    bool GetTileData(int32 Level, int32 TileIndex, TArray<uint8>& OutMagnitudes);
+
+    /**
+     * Get a tile as a transient grayscale texture (PF_G8) for UI display.
+     * Builds the tile first if it is not cached, so prefer RequestTile() for uncached tiles.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Audio|Spectrogram")
+    UTexture2D* GetTileTexture(int32 Level, int32 TileIndex);
+
+private:
+    /** Everything fixed by one Open(); shared read-only with tile builds still running */
+    struct FOpenState
+    {
+        /** Distinguishes this Open() from earlier and later ones */
+        uint32 Generation = 0;
+
+        int32 FFTSize = 0;
+        int32 TileWidth = 0;
+        float MinDecibels = 0.0f;
+        float MaxDecibels = 0.0f;
+
+        /** Scale that maps squared FFT magnitude to power relative to a full-scale sine */
+        float PowerScale = 1.0f;
+
+        /** Hann window, FFTSize samples */
+        TArray<float> Window;
+
+        int64 NumFrames = 0;
+        int32 SampleRate = 0;
+        int32 NumLevels = 0;
+
+        int32 GetHopSize() const { return FFTSize / 4; }
+        int32 GetNumBins() const { return FFTSize / 2; }
+        int64 GetFramesPerTile(int32 Level) const { return ((int64)TileWidth * GetHopSize()) << Level; }
+        int32 GetNumTiles(int32 Level) const;
+    };
+
+    typedef TSharedPtr<const FOpenState, ESPMode::ThreadSafe> FOpenStatePtr;
+
+    /** The current open state, or null when closed */
+    FOpenStatePtr GetOpenState() const;
+
+    bool IsCurrentGeneration(uint32 Generation) const;
+
+    /** Serve a tile of this open state from the cache, or build and cache it */
+    bool LoadOrBuildTile(const FOpenState& State, int32 Level, int32 TileIndex, TArray<uint8>& OutMagnitudes);
+
+    /** STFT one level-0 tile, in parallel over blocks of columns */
+    bool ComputeBaseTile(const FOpenState& State, int32 TileIndex, TArray<uint8>& OutMagnitudes);
+
+    /** Build a coarser tile by max-pooling pairs of columns from its two child tiles */
+    bool BuildParentTile(const FOpenState& State, int32 Level, int32 TileIndex, TArray<uint8>& OutMagnitudes);
+
+    /** Load or create the cache file and index the tiles already in it */
+    bool OpenCache(const FOpenState& State);
+
+    bool ReadCachedTile(const FOpenState& State, uint64 TileKey, TArray<uint8>& OutMagnitudes);
+
+    /** Append a tile, unless the file it was built from has been closed in the meantime */
+    void WriteCachedTile(const FOpenState& State, uint64 TileKey, const TArray<uint8>& Magnitudes);
+
+    static uint64 MakeTileKey(int32 Level, int32 TileIndex) { return ((uint64)(uint32)Level << 32) | (uint32)TileIndex; }
+
+    struct FCachedTile
+    {
+        int64 Offset;
+        int32 CompressedSize;
+    };
+
+    FString WavPath;
+    FString CachePath;
+
+    /** Source audio and its open state; guarded by ReaderLock */
+    FWavStreamReader Reader;
+    FOpenStatePtr OpenState;
+    uint32 LastGeneration;
+    mutable FCriticalSection ReaderLock;
+
+    /** Cache file, its tile index and in-flight requests; guarded by CacheLock */
+    TUniquePtr<IFileHandle> CacheFile;
+    TMap<uint64, FCachedTile> CachedTiles;
+    TSet<uint64> PendingTiles;
+    uint32 CacheGeneration;
+    mutable FCriticalSection CacheLock;
+
+    /** Background tile builds that still reference this object */
+    FThreadSafeCounter NumPendingRequests;
+};
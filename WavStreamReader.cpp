@@ -0,0 +1,241 @@
+#include "WavStreamReader.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+FWavStreamReader::FWavStreamReader()
+{
+}
+
+FWavStreamReader::~FWavStreamReader()
+{
+    Close();
+}
+
+bool FWavStreamReader::Open(const FString& InFilePath)
+{
+    Close();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    FileHandle.Reset(PlatformFile.OpenRead(*InFilePath));
+    if (!FileHandle.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("WavStreamReader: Could not open %s"), *InFilePath);
+        return false;
+    }
+
+    const int64 FileSize = FileHandle->Size();
+
+    uint8 RiffHeader[12];
+    if (!ReadBytes(0, sizeof(RiffHeader), RiffHeader) ||
+        FMemory::Memcmp(RiffHeader, "RIFF", 4) != 0 ||
+        FMemory::Memcmp(RiffHeader + 8, "WAVE", 4) != 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("WavStreamReader: Not a RIFF/WAVE file: %s"), *InFilePath);
+        Close();
+        return false;
+    }
+
+    // Walk the chunk list — only the chunk headers are read
+    bool bFoundFmt = false;
+    bool bFoundData = false;
+    int64 DataSize = 0;
+    int64 ChunkOffset = 12;
+
+    while (ChunkOffset + 8 <= FileSize && !(bFoundFmt && bFoundData))
+    {
+        uint8 ChunkHeader[8];
+        if (!ReadBytes(ChunkOffset, sizeof(ChunkHeader), ChunkHeader))
+        {
+            break;
+        }
+
+        const uint32 ChunkSize = *reinterpret_cast<const uint32*>(&ChunkHeader[4]);
+        const int64 ChunkDataOffset = ChunkOffset + 8;
+
+        if (FMemory::Memcmp(ChunkHeader, "fmt ", 4) == 0 && ChunkSize >= 16)
+        {
+            uint8 Fmt[16];
+            if (!ReadBytes(ChunkDataOffset, sizeof(Fmt), Fmt))
+            {
+                break;
+            }
+
+            const uint16 AudioFormat = *reinterpret_cast<const uint16*>(&Fmt[0]);
+            NumChannels              = *reinterpret_cast<const uint16*>(&Fmt[2]);
+            SampleRate               = *reinterpret_cast<const uint32*>(&Fmt[4]);
+            BitsPerSample            = *reinterpret_cast<const uint16*>(&Fmt[14]);
+
+            if (AudioFormat != 1)
+            {
+                UE_LOG(LogTemp, Error, TEXT("WavStreamReader: WAV is not PCM format (format tag: %d): %s"), AudioFormat, *InFilePath);
+                Close();
+                return false;
+            }
+
+            bFoundFmt = true;
+        }
+        else if (FMemory::Memcmp(ChunkHeader, "data", 4) == 0)
+        {
+            DataOffset = ChunkDataOffset;
+            DataSize = ChunkSize;
+            bFoundData = true;
+        }
+
+        // Chunks are padded to an even size
+        ChunkOffset = ChunkDataOffset + ChunkSize + (ChunkSize & 1);
+    }
+
+    if (!bFoundFmt || !bFoundData)
+    {
+        UE_LOG(LogTemp, Error, TEXT("WavStreamReader: Missing 'fmt ' or 'data' chunk: %s"), *InFilePath);
+        Close();
+        return false;
+    }
+
+    if (NumChannels <= 0 || SampleRate <= 0 ||
+        (BitsPerSample != 16 && BitsPerSample != 24 && BitsPerSample != 32))
+    {
+        UE_LOG(LogTemp, Error, TEXT("WavStreamReader: Unsupported format (%d Hz, %d ch, %d-bit): %s"),
+               SampleRate, NumChannels, BitsPerSample, *InFilePath);
+        Close();
+        return false;
+    }
+
+    if (DataOffset + DataSize > FileSize)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("WavStreamReader: data chunk size (%lld) exceeds file bounds, clamping"), DataSize);
+        DataSize = FileSize - DataOffset;
+    }
+
+    BytesPerFrame = NumChannels * (BitsPerSample / 8);
+    NumFrames = DataSize / BytesPerFrame;
+    FilePath = InFilePath;
+
+    return true;
+}
+
+void FWavStreamReader::Close()
+{
+    FileHandle.Reset();
+    FilePath.Empty();
+    DataOffset = 0;
+    NumFrames = 0;
+    SampleRate = 0;
+    NumChannels = 0;
+    BitsPerSample = 0;
+    BytesPerFrame = 0;
+}
+
+bool FWavStreamReader::ReadMonoFloat(int64 StartFrame, int32 NumFramesToRead, float* OutSamples)
+{
+    if (!IsOpen() || NumFramesToRead <= 0)
+    {
+        return false;
+    }
+
+    // Clip the request to the data chunk and zero-fill the rest
+    const int64 FirstValid = FMath::Clamp<int64>(StartFrame, 0, NumFrames);
+    const int64 EndValid = FMath::Clamp<int64>(StartFrame + NumFramesToRead, 0, NumFrames);
+    const int32 LeadingSilence = (int32)(FirstValid - StartFrame);
+    const int32 NumValid = (int32)FMath::Max<int64>(EndValid - FirstValid, 0);
+
+    FMemory::Memzero(OutSamples, NumFramesToRead * sizeof(float));
+    if (NumValid == 0)
+    {
+        return true;
+    }
+
+    const int64 NumBytes = (int64)NumValid * BytesPerFrame;
+    if (ScratchBuffer.Num() < NumBytes)
+    {
+        ScratchBuffer.SetNumUninitialized(NumBytes);
+    }
+
+    if (!ReadBytes(DataOffset + FirstValid * BytesPerFrame, NumBytes, ScratchBuffer.GetData()))
+    {
+        return false;
+    }
+
+    float* Out = OutSamples + FMath::Max(LeadingSilence, 0);
+    const uint8* In = ScratchBuffer.GetData();
+    const float ChannelScale = 1.0f / NumChannels;
+
+    if (BitsPerSample == 16)
+    {
+        const int16* Samples = reinterpret_cast<const int16*>(In);
+        const float Scale = ChannelScale / 32768.0f;
+        for (int32 Frame = 0; Frame < NumValid; Frame++)
+        {
+            int32 Sum = 0;
+            for (int32 Channel = 0; Channel < NumChannels; Channel++)
+            {
+                Sum += Samples[Frame * NumChannels + Channel];
+            }
+            Out[Frame] = Sum * Scale;
+        }
+    }
+    else if (BitsPerSample == 24)
+    {
+        const float Scale = ChannelScale / 8388608.0f;
+        for (int32 Frame = 0; Frame < NumValid; Frame++)
+        {
+            float Sum = 0.0f;
+            for (int32 Channel = 0; Channel < NumChannels; Channel++)
+            {
+                const uint8* Sample = In + (Frame * NumChannels + Channel) * 3;
+                // Place the 3 bytes in the top of an int32 and shift back down to sign-extend
+                const int32 Value = (int32)((uint32)Sample[0] << 8 | (uint32)Sample[1] << 16 | (uint32)Sample[2] << 24) >> 8;
+                Sum += (float)Value;
+            }
+            Out[Frame] = Sum * Scale;
+        }
+    }
+    else // 32-bit integer PCM
+    {
+        const int32* Samples = reinterpret_cast<const int32*>(In);
+        const float Scale = ChannelScale / 2147483648.0f;
+        for (int32 Frame = 0; Frame < NumValid; Frame++)
+        {
+            float Sum = 0.0f;
+            for (int32 Channel = 0; Channel < NumChannels; Channel++)
+            {
+                Sum += (float)Samples[Frame * NumChannels + Channel];
+            }
+            Out[Frame] = Sum * Scale;
+        }
+    }
+
+    return true;
+}
+
+bool FWavStreamReader::ReadFrames(int64 StartFrame, int64 NumFramesToRead, TArray<uint8>& OutPCMData)
+{
+    if (!IsOpen())
+    {
+        return false;
+    }
+
+    const int64 FirstFrame = FMath::Clamp<int64>(StartFrame, 0, NumFrames);
+    const int64 EndFrame = FMath::Clamp<int64>(StartFrame + NumFramesToRead, FirstFrame, NumFrames);
+
+    // TArray sizes are int32; callers read long ranges in blocks
+    const int64 NumBytes = (EndFrame - FirstFrame) * BytesPerFrame;
+    if (NumBytes > MAX_int32)
+    {
+        UE_LOG(LogTemp, Error, TEXT("WavStreamReader: Read of %lld bytes is too large, read it in blocks: %s"), NumBytes, *FilePath);
+        return false;
+    }
+
+    OutPCMData.SetNumUninitialized((int32)NumBytes);
+    if (OutPCMData.Num() == 0)
+    {
+        return true;
+    }
+
+    return ReadBytes(DataOffset + FirstFrame * BytesPerFrame, OutPCMData.Num(), OutPCMData.GetData());
+}
+
+bool FWavStreamReader::ReadBytes(int64 Offset, int64 NumBytes, uint8* OutBytes)
+{
+    return FileHandle->Seek(Offset) && FileHandle->Read(OutBytes, NumBytes);
+}
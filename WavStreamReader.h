@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+
+/**
+ * Reads PCM WAV files incrementally instead of loading the whole file into memory.
+ * Only the RIFF chunk headers are read on Open(); sample data is read on demand.
+ *
+ * Not thread-safe — use one reader per thread or guard it externally.
+ */
+class TEST_API FWavStreamReader
+{
+public:
+    FWavStreamReader();
+    ~FWavStreamReader();
+
+    /** Open a WAV file and locate its 'fmt ' and 'data' chunks */
+    bool Open(const FString& FilePath);
+
+    void Close();
+
+    bool IsOpen() const { return FileHandle.IsValid(); }
+
+    int32 GetSampleRate() const { return SampleRate; }
+    int32 GetNumChannels() const { return NumChannels; }
+    int32 GetBitsPerSample() const { return BitsPerSample; }
+    int64 GetNumFrames() const { return NumFrames; }
+
+    /**
+     * Read frames downmixed to mono float in [-1, 1].
+     * Frames outside the file are returned as silence.
+     *
+     * @param StartFrame    First frame to read (may be negative or past the end)
+     * @param NumFramesToRead Number of frames to write to OutSamples
+     * @param OutSamples    Destination, at least NumFramesToRead floats
+     */
+    bool ReadMonoFloat(int64 StartFrame, int32 NumFramesToRead, float* OutSamples);
+
+    /**
+     * Read raw interleaved PCM for a range of frames, in the file's own bit depth.
+     * The range is clipped to the data chunk. Fails if the clipped range exceeds 2 GB.
+     */
+    bool ReadFrames(int64 StartFrame, int64 NumFramesToRead, TArray<uint8>& OutPCMData);
+
+private:
+    bool ReadBytes(int64 Offset, int64 NumBytes, uint8* OutBytes);
+
+    TUniquePtr<IFileHandle> FileHandle;
+    FString FilePath;
+
+    int64 DataOffset = 0;
+    int64 NumFrames = 0;
+    int32 SampleRate = 0;
+    int32 NumChannels = 0;
+    int32 BitsPerSample = 0;
+    int32 BytesPerFrame = 0;
+
+    /** Raw PCM staging buffer reused across reads */
+    TArray<uint8> ScratchBuffer;
+};